@@ -0,0 +1,410 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <chrono>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include "HungarianAlgorithm.h"
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+//----------------------------------------------------------------------------------//
+// Benchmark of the solver strategies on generated workloads. Each case (cost type,
+// strategy, workload, size) is solved repeatedly, and the median/p99 time of setting
+// the cost function matrix and solving, the iterations of the solver, and the peak
+// heap memory are written as JSON.
+//
+// Usage:
+//      HungAlgoBench [--max-size 4096] [--min-time 0.2] [--types int,float,double]
+//                    [--strategies Munkres,ShortestAugmentingPath,Auction]
+//                    [--workloads uniform,ties,equal,euclidean,rectangular]
+//                    [--threads 1] [--output results.json]
+//----------------------------------------------------------------------------------//
+
+// Heap memory currently allocated and its peak since the last reset
+static std::atomic<long long> heapBytes(0), peakHeapBytes(0);
+// Header in front of each allocation to know its size when it is freed
+static const std::size_t allocationHeader = 16;
+// Maximum number of solves of one case
+static const int maxRepetitions = 10000;
+
+// Settings of the benchmark
+struct BenchmarkSettings
+{
+    int maxSize = 4096;
+    double minTime = 0.2;
+    std::vector<std::string> types = {"int", "float", "double"};
+    std::vector<std::string> strategies = {"Munkres", "ShortestAugmentingPath", "Auction"};
+    std::vector<std::string> workloads = {"uniform", "ties", "equal", "euclidean", "rectangular"};
+    int nrThreads = 1;
+    std::string outputFile;
+};
+
+// Result of one benchmark case
+struct BenchmarkResult
+{
+    std::string type, strategy, workload;
+    int nrRows, nrCols, nrThreads, nrRepetitions;
+    double medianMs, p99Ms;
+    long long nrIterations, peakHeapBytes;
+    double totalCost;
+};
+
+std::vector<std::string> splitList(const std::string &list);
+template <typename T>
+Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> generateCosts(const std::string &workload, int size, std::mt19937 &randomGenerator);
+template <typename T>
+void runCases(const BenchmarkSettings &settings, const std::string &type, std::vector<BenchmarkResult> &results);
+void writeJson(std::ostream &stream, const std::vector<BenchmarkResult> &results);
+
+int main(int argc, const char *argv[])
+{
+    BenchmarkSettings settings;
+    for (int idxArg = 1; idxArg + 1 < argc; idxArg += 2)
+    {
+        std::string option = argv[idxArg], value = argv[idxArg + 1];
+        if (option == "--max-size")
+        {
+            settings.maxSize = std::atoi(value.c_str());
+        }
+        else if (option == "--min-time")
+        {
+            settings.minTime = std::atof(value.c_str());
+        }
+        else if (option == "--types")
+        {
+            settings.types = splitList(value);
+        }
+        else if (option == "--strategies")
+        {
+            settings.strategies = splitList(value);
+        }
+        else if (option == "--workloads")
+        {
+            settings.workloads = splitList(value);
+        }
+        else if (option == "--threads")
+        {
+            settings.nrThreads = std::atoi(value.c_str());
+        }
+        else if (option == "--output")
+        {
+            settings.outputFile = value;
+        }
+        else
+        {
+            std::cerr << "Unknown option " << option << "\n";
+            return 1;
+        }
+    }
+
+    std::vector<BenchmarkResult> results;
+    for (const std::string &type : settings.types)
+    {
+        if (type == "int")
+        {
+            runCases<int>(settings, type, results);
+        }
+        else if (type == "float")
+        {
+            runCases<float>(settings, type, results);
+        }
+        else if (type == "double")
+        {
+            runCases<double>(settings, type, results);
+        }
+    }
+
+    if (settings.outputFile.empty())
+    {
+        writeJson(std::cout, results);
+    }
+    else
+    {
+        std::ofstream outputStream(settings.outputFile);
+        writeJson(outputStream, results);
+    }
+    return 0;
+}
+
+std::vector<std::string> splitList(const std::string &list)
+{
+    std::vector<std::string> items;
+    std::stringstream listStream(list);
+    std::string item;
+    while (std::getline(listStream, item, ','))
+    {
+        items.push_back(item);
+    }
+    return items;
+}
+
+template <typename T>
+Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> generateCosts(const std::string &workload, int size, std::mt19937 &randomGenerator)
+{
+    // Highly rectangular problems have 16 times more cols than rows
+    int nrRows = (workload == "rectangular") ? std::max(1, size / 16) : size;
+    Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> costFcnMatrix(nrRows, size);
+    if (workload == "equal")
+    {
+        // All assignments have the same cost
+        costFcnMatrix.fill(1);
+    }
+    else if (workload == "ties")
+    {
+        // Few distinct integer costs
+        std::uniform_int_distribution<int> costDistribution(0, 9);
+        for (int idx = 0; idx < costFcnMatrix.size(); idx++)
+        {
+            costFcnMatrix(idx) = (T)costDistribution(randomGenerator);
+        }
+    }
+    else if (workload == "euclidean")
+    {
+        // Distances between two sets of random points
+        std::uniform_real_distribution<double> positionDistribution(0, 1000);
+        std::vector<double> rowPoints(2 * nrRows), colPoints(2 * size);
+        for (double &position : rowPoints)
+        {
+            position = positionDistribution(randomGenerator);
+        }
+        for (double &position : colPoints)
+        {
+            position = positionDistribution(randomGenerator);
+        }
+        for (int col = 0; col < size; col++)
+        {
+            for (int row = 0; row < nrRows; row++)
+            {
+                costFcnMatrix(row, col) = (T)std::round(std::hypot(rowPoints[2 * row] - colPoints[2 * col], rowPoints[2 * row + 1] - colPoints[2 * col + 1]) * 100) / (T)100;
+            }
+        }
+    }
+    else
+    {
+        // Uniformly distributed costs
+        std::uniform_real_distribution<double> costDistribution(0, 10000);
+        for (int idx = 0; idx < costFcnMatrix.size(); idx++)
+        {
+            costFcnMatrix(idx) = (T)costDistribution(randomGenerator);
+        }
+    }
+    return costFcnMatrix;
+}
+
+template <typename T>
+void runCases(const BenchmarkSettings &settings, const std::string &type, std::vector<BenchmarkResult> &results)
+{
+    std::mt19937 randomGenerator(42);
+    for (const std::string &workload : settings.workloads)
+    {
+        for (int size = 4; size <= settings.maxSize; size *= 4)
+        {
+            Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> costFcnMatrix = generateCosts<T>(workload, size, randomGenerator);
+            for (const std::string &strategy : settings.strategies)
+            {
+                SolverStrategy solverStrategy = SolverStrategy::Munkres;
+                for (int idx = 0; idx < (int)(sizeof(SolverStrategyName) / sizeof(SolverStrategyName[0])); idx++)
+                {
+                    if (strategy == SolverStrategyName[idx])
+                    {
+                        solverStrategy = (SolverStrategy)idx;
+                    }
+                }
+                std::cerr << type << " " << strategy << " " << workload << " " << costFcnMatrix.rows() << "x" << costFcnMatrix.cols() << "\n";
+
+                // Repeat until the minimum time is reached (at least 3 times, unless a single solve takes very long)
+                BenchmarkResult result;
+                std::vector<double> solveTimes;
+                solveTimes.reserve(maxRepetitions);
+                std::vector<int> rowIndices, colIndices;
+                long long heapBytesBefore = heapBytes;
+                peakHeapBytes = heapBytesBefore;
+                {
+                    auto problem = HungarianAlgorithm<T>(solverStrategy);
+                    problem.SetNrOfThreads(settings.nrThreads);
+                    double totalTime = 0;
+                    while (((totalTime < settings.minTime) || ((solveTimes.size() < 3) && (totalTime < 10 * settings.minTime))) &&
+                           (solveTimes.size() < maxRepetitions))
+                    {
+                        auto startTime = std::chrono::steady_clock::now();
+                        problem.SetCostFunctionMatrix(costFcnMatrix);
+                        problem.SolveAssignmentProblem();
+                        double solveTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+                        solveTimes.push_back(solveTime * 1000);
+                        totalTime += solveTime;
+                    }
+                    problem.GetAssignmentResults(rowIndices, colIndices);
+                    result.nrIterations = problem.getNrOfIterations();
+                }
+                result.peakHeapBytes = peakHeapBytes - heapBytesBefore;
+
+                result.type = type;
+                result.strategy = strategy;
+                result.workload = workload;
+                result.nrRows = (int)costFcnMatrix.rows();
+                result.nrCols = (int)costFcnMatrix.cols();
+                result.nrThreads = settings.nrThreads;
+                result.nrRepetitions = (int)solveTimes.size();
+                std::sort(solveTimes.begin(), solveTimes.end());
+                result.medianMs = solveTimes[solveTimes.size() / 2];
+                result.p99Ms = solveTimes[(size_t)std::ceil(0.99 * solveTimes.size()) - 1];
+                result.totalCost = 0;
+                for (int row = 0; row < result.nrRows; row++)
+                {
+                    if (rowIndices[row] >= 0)
+                    {
+                        result.totalCost += (double)costFcnMatrix(row, rowIndices[row]);
+                    }
+                }
+                results.push_back(result);
+            }
+        }
+    }
+}
+
+void writeJson(std::ostream &stream, const std::vector<BenchmarkResult> &results)
+{
+    stream << "{\n  \"results\": [\n";
+    for (size_t idx = 0; idx < results.size(); idx++)
+    {
+        const BenchmarkResult &result = results[idx];
+        stream << "    {\"type\": \"" << result.type << "\", \"strategy\": \"" << result.strategy
+               << "\", \"workload\": \"" << result.workload << "\", \"rows\": " << result.nrRows
+               << ", \"cols\": " << result.nrCols << ", \"threads\": " << result.nrThreads << ", \"repetitions\": " << result.nrRepetitions
+               << ", \"median_ms\": " << result.medianMs << ", \"p99_ms\": " << result.p99Ms
+               << ", \"iterations\": " << result.nrIterations << ", \"peak_heap_bytes\": " << result.peakHeapBytes
+               << ", \"total_cost\": " << std::setprecision(12) << result.totalCost << std::setprecision(6) << "}"
+               << ((idx + 1 < results.size()) ? ",\n" : "\n");
+    }
+    stream << "  ]";
+#if defined(__unix__) || defined(__APPLE__)
+    // Peak resident memory of the whole process (kilobytes on Linux, bytes on macOS)
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    stream << ",\n  \"max_rss\": " << usage.ru_maxrss;
+#endif
+    stream << "\n}\n";
+}
+
+// Track the heap memory of the program (Eigen matrices are allocated with malloc and not included). The replaced
+// functions are not inlined, otherwise the compiler sees the header reads of the callers' arrays (-Warray-bounds)
+#if defined(_MSC_VER)
+#define NOINLINE_ALLOCATION __declspec(noinline)
+#elif defined(__GNUC__)
+#define NOINLINE_ALLOCATION __attribute__((noinline))
+#else
+#define NOINLINE_ALLOCATION
+#endif
+
+// Store the size in the header of a new allocation and add it to the tracked heap memory
+static void *TrackAllocation(char *allocation, std::size_t size, std::size_t header)
+{
+    if (allocation == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    std::memcpy(allocation, &size, sizeof(size));
+    long long currentBytes = (heapBytes += (long long)size);
+    long long peakBytes = peakHeapBytes;
+    while ((currentBytes > peakBytes) && !peakHeapBytes.compare_exchange_weak(peakBytes, currentBytes))
+    {
+    }
+    return allocation + header;
+}
+
+// Remove the size in the header of an allocation from the tracked heap memory
+static void UntrackAllocation(char *allocation)
+{
+    std::size_t size;
+    std::memcpy(&size, allocation, sizeof(size));
+    heapBytes -= (long long)size;
+}
+
+NOINLINE_ALLOCATION void *operator new(std::size_t size)
+{
+    return TrackAllocation((char *)std::malloc(size + allocationHeader), size, allocationHeader);
+}
+NOINLINE_ALLOCATION void *operator new[](std::size_t size) { return operator new(size); }
+NOINLINE_ALLOCATION void operator delete(void *ptr) noexcept
+{
+    if (ptr != nullptr)
+    {
+        char *allocation = (char *)ptr - allocationHeader;
+        UntrackAllocation(allocation);
+        std::free(allocation);
+    }
+}
+NOINLINE_ALLOCATION void operator delete[](void *ptr) noexcept { operator delete(ptr); }
+NOINLINE_ALLOCATION void operator delete(void *ptr, std::size_t) noexcept { operator delete(ptr); }
+NOINLINE_ALLOCATION void operator delete[](void *ptr, std::size_t) noexcept { operator delete(ptr); }
+
+#if defined(__cpp_aligned_new)
+// Over-aligned types (C++17): the header is widened to the alignment to keep the returned pointer aligned
+static std::size_t AlignedHeader(std::align_val_t alignment)
+{
+    return std::max(allocationHeader, (std::size_t)alignment);
+}
+NOINLINE_ALLOCATION void *operator new(std::size_t size, std::align_val_t alignment)
+{
+    std::size_t header = AlignedHeader(alignment);
+#if defined(_MSC_VER)
+    char *allocation = (char *)_aligned_malloc(size + header, (std::size_t)alignment);
+#else
+    // The size of aligned_alloc must be a multiple of the alignment
+    std::size_t alignedSize = (size + header + (std::size_t)alignment - 1) / (std::size_t)alignment * (std::size_t)alignment;
+    char *allocation = (char *)std::aligned_alloc((std::size_t)alignment, alignedSize);
+#endif
+    return TrackAllocation(allocation, size, header);
+}
+NOINLINE_ALLOCATION void *operator new[](std::size_t size, std::align_val_t alignment) { return operator new(size, alignment); }
+NOINLINE_ALLOCATION void operator delete(void *ptr, std::align_val_t alignment) noexcept
+{
+    if (ptr != nullptr)
+    {
+        char *allocation = (char *)ptr - AlignedHeader(alignment);
+        UntrackAllocation(allocation);
+#if defined(_MSC_VER)
+        _aligned_free(allocation);
+#else
+        std::free(allocation);
+#endif
+    }
+}
+NOINLINE_ALLOCATION void operator delete[](void *ptr, std::align_val_t alignment) noexcept { operator delete(ptr, alignment); }
+NOINLINE_ALLOCATION void operator delete(void *ptr, std::size_t, std::align_val_t alignment) noexcept { operator delete(ptr, alignment); }
+NOINLINE_ALLOCATION void operator delete[](void *ptr, std::size_t, std::align_val_t alignment) noexcept { operator delete(ptr, alignment); }
+#endif
@@ -0,0 +1,109 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#ifndef AUCTIONSOLVER_H_
+#define AUCTIONSOLVER_H_
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include "CostMatrixView.h"
+#include "ThreadPool.h"
+#include "SolveStatistics.h"
+
+//----------------------------------------------------------------------------------//
+// Auction solver (Bertsekas) for rectangular assignment problems with nrRows <= nrCols.
+// The rows bid for the cols which give them the best value (-cost - price) and the
+// prices of the cols rise with every accepted bid. The bids of all unassigned rows are
+// computed in parallel (Jacobi bidding) and then resolved per col. Epsilon-scaling
+// runs the auction repeatedly with decreasing bid increments, keeping the prices of
+// the previous run.
+//
+// The final assignment is within nrCols * epsilon of the optimal cost. For integer
+// cost types, the costs are scaled by (nrCols + 1) and the auction ends with epsilon
+// 1, which gives an optimal assignment. Missing rows (nrRows < nrCols) are added as
+// dummy rows with zero costs.
+//
+// Example:
+//      DenseCostMatrixView<float> costView(costFcnMatrix.data(), 3, 3, 1, 3);
+//      AuctionSolver<float> solver;
+//      solver.Solve(costView, nullptr);
+//      solver.GetRowAssignment(); // [0, 2, 1]
+//----------------------------------------------------------------------------------//
+template <typename T>
+class AuctionSolver
+{
+private:
+    // Dimensions of the solved problem (without dummy rows)
+    int nrRows, nrCols;
+    // Factor applied to all costs (> 1 for exact integer solutions)
+    double costScale;
+    // Final bid increment for non-integer costs (relative to the largest cost)
+    double relativeEpsilon;
+    // Price of each col
+    std::vector<double> prices;
+    // Assigned col of each (real or dummy) row and assigned row of each col (-1 if unassigned)
+    std::vector<int> auctionRowAssignment, auctionColAssignment;
+    // Assignments of the real rows, dummy rows are reported as unassigned cols (-1)
+    std::vector<int> rowAssignment, colAssignment;
+    // Unassigned rows of the current round, and their bids
+    std::vector<int> biddingRows, bidCols, nextBiddingRows;
+    std::vector<double> bidPrices;
+    // Best bid for each col in the current round
+    std::vector<double> bestBidPrice;
+    std::vector<int> bestBidRow, biddenCols;
+    // Zero cost of the dummy rows
+    T zeroCost;
+    // Number of bidding rounds of the last solve
+    int nrOfRounds;
+
+    // Compute the bid of a row for its best col
+    void ComputeBid(CostMatrixView<T> &costMatrix, int idxBid, double epsilon);
+    // Run the auction until all rows are assigned
+    void RunAuction(CostMatrixView<T> &costMatrix, double epsilon, ThreadPool *threadPool);
+
+public:
+    AuctionSolver();
+
+    // Set the final bid increment for non-integer costs, relative to the largest cost
+    void SetRelativeEpsilon(double epsilon);
+    // Solve the assignment problem, the bids are computed on the thread pool (if not null)
+    void Solve(CostMatrixView<T> &costMatrix, ThreadPool *threadPool);
+    // Get the assigned col of each row
+    const std::vector<int> &GetRowAssignment() const { return rowAssignment; };
+    // Get the assigned row of each col (-1 if unassigned)
+    const std::vector<int> &GetColAssignment() const { return colAssignment; };
+    // Get the final price of each col (in units of the costs)
+    void GetColPrices(std::vector<double> &colPrices) const;
+    // Get the number of bidding rounds of the last solve
+    int GetNrOfRounds() const { return nrOfRounds; };
+    // Get the number of bytes reserved by the workspace
+    size_t GetWorkspaceSize() const;
+};
+
+#endif // AUCTIONSOLVER_H_
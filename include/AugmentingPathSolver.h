@@ -0,0 +1,227 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#ifndef AUGMENTINGPATHSOLVER_H_
+#define AUGMENTINGPATHSOLVER_H_
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include <chrono>
+#include "SolveStatistics.h"
+#include "CostMatrixView.h"
+#include "ThreadPool.h"
+
+//----------------------------------------------------------------------------------//
+// Budget of a solve, the solve stops when one of the limits is reached
+//----------------------------------------------------------------------------------//
+struct SolveBudget
+{
+    // Maximum wall time of the solve in seconds (infinity -> no limit)
+    double maxTime = std::numeric_limits<double>::infinity();
+    // Maximum number of rows scanned by the shortest path searches (-1 -> no limit)
+    long long maxIterations = -1;
+
+    // Check if the budget limits the solve
+    bool IsLimited() const { return (maxTime < std::numeric_limits<double>::infinity()) || (maxIterations >= 0); };
+};
+
+//----------------------------------------------------------------------------------//
+// Shortest augmenting path solver (Jonker-Volgenant) for rectangular assignment
+// problems with nrRows <= nrCols. The rows are assigned one at a time along the
+// shortest path in the reduced costs (cost - rowPotential - colPotential), which keeps
+// the dual potentials feasible after every augmentation. Each augmentation costs
+// O(nrRows * nrCols), so a full solve runs in O(nrRows^2 * nrCols) time with O(nrCols)
+// memory on top of the cost function matrix.
+//
+// A solved problem can be re-solved incrementally after some costs changed: only the
+// rows/cols whose changes break the optimality conditions lose their assignments and
+// get new dual potentials, and only those rows are augmented again. Rows/cols can be
+// added or removed the same way: the new lines and the partners of the removed ones are
+// repaired, which costs a few augmentations (O(nrRows * nrCols) each) per changed line.
+//
+// A solve can be limited by a budget of time and/or scanned rows. The searches stop when
+// the budget runs out, and the partial solution (some rows assigned, feasible dual
+// potentials) and the running search are kept, so that a later call can continue from
+// where the solve stopped.
+//
+// With a thread pool, the scans of the remaining cols of large problems are split into
+// chunks on the threads. The closest cols of the chunks are combined in chunk order with
+// the same tie rule, so the results are identical to the single-threaded solve.
+//
+// Example:
+//      Eigen::MatrixXf costFcnMatrix(3, 3);
+//      costFcnMatrix << 10.5, 22, 18, 42, 5.9, 6, 71.2, 8.4, 69;
+//      DenseCostMatrixView<float> costView(costFcnMatrix.data(), 3, 3, 1, 3);
+//      AugmentingPathSolver<float> solver;
+//      solver.Solve(costView);
+//      solver.GetRowAssignment(); // [0, 2, 1]
+//----------------------------------------------------------------------------------//
+template <typename T>
+class AugmentingPathSolver
+{
+private:
+    // Dimensions of the solved problem
+    int nrRows, nrCols;
+    // Dual potentials of the rows and the cols
+    std::vector<double> rowPotential, colPotential;
+    // Assigned col of each row and assigned row of each col (-1 if unassigned)
+    std::vector<int> rowAssignment, colAssignment;
+    // Cost of the shortest path to each col found in the current search
+    std::vector<double> shortestPathCosts;
+    // Previous row of each col on the shortest path tree
+    std::vector<int> pathRow;
+    // Cols which have not been reached by the current search yet
+    std::vector<int> remainingCols;
+    // Rows and cols which are part of the current shortest path tree
+    std::vector<char> visitedRows, visitedCols;
+    // Cost of the last found shortest augmenting path
+    double minPathCost;
+    // Next row to scan and number of remaining cols of the current search
+    int searchRow, nrRemainingCols;
+    // Start row of the search stopped by the budget (-1 if none), continued by the next solve
+    int interruptedStartRow;
+    // Set if the assignments and dual potentials are optimal for the last solved problem
+    bool hasSolution;
+    // Changed elements (row, col) which break the optimality of the last solution
+    std::vector<std::pair<int, int>> violatedElements;
+    // Rows/cols which have to be repaired before re-solving
+    std::vector<char> dirtyRows, dirtyCols;
+    // Cols which have to get a zero dual potential (rectangular problems only)
+    std::vector<int> releasedCols;
+    // Free cols whose potentials have to be made feasible, and zero for rectangular problems (new cols and the cols of
+    // removed rows)
+    std::vector<char> unbalancedCols;
+    // Set if dirtyRows/dirtyCols/unbalancedCols hold the lines of a resized problem, to be repaired by the next re-solve
+    bool hasDirtyLines;
+    // State of the solution before resizing the problem, and the new index of each previous row/col (-1 if removed)
+    std::vector<double> previousRowPotential, previousColPotential;
+    std::vector<int> previousRowAssignment, previousColAssignment;
+    std::vector<char> previousDirtyRows, previousDirtyCols, previousUnbalancedCols;
+    std::vector<int> newRowOfSource, newColOfSource;
+    // Cost of the shortest path to each row and previous col of each row in the search of an unbalanced col
+    std::vector<double> rowPathCosts;
+    std::vector<int> pathCol;
+    // Number of rows scanned by the searches of the last (re-)solve
+    long long nrOfScannedRows;
+    // Limits of the next solves: deadline (if hasDeadline is set) and maximum number of scanned rows (-1 if none)
+    std::chrono::steady_clock::time_point deadline;
+    bool hasDeadline;
+    long long maxScannedRows;
+    // Set if the last solve stopped because its budget ran out
+    bool isInterrupted;
+    // Statistics of the running solve (only used with HUNGARIAN_ENABLE_STATS)
+    SolveStatistics *statistics;
+    // Closest col found by a scan of remaining cols (index in remainingCols)
+    struct ScanResult
+    {
+        int idxClosest;
+        double closestCost;
+        bool closestAssigned;
+    };
+    // Row scanned on the threads (chunk i covers the i-th part of the first nrRemainingCols remaining cols)
+    struct ParallelScan
+    {
+        int row;
+        const T *costRow;
+        Eigen::Index colStride;
+        int nrRemainingCols, nrChunks;
+    };
+    // Thread pool used for the scans of large problems (null if single-threaded)
+    ThreadPool *threadPool;
+    ParallelScan parallelScan;
+    std::vector<ScanResult> chunkResults;
+
+    // Relax the remaining cols remainingCols[idxBegin, idxEnd) through a row and find the closest one
+    ScanResult ScanRemainingCols(int row, const T *costRow, Eigen::Index colStride, int idxBegin, int idxEnd);
+    // Find the shortest augmenting path starting at a free row, returns the free col at its end (-1 if none exists)
+    int FindShortestAugmentingPath(CostMatrixView<T> &costMatrix, int startRow);
+    // Update the dual potentials and flip the assignments along the found path
+    void AugmentPath(int startRow, int sinkCol);
+    // Resize the workspace to the problem dimensions
+    void PrepareWorkspace();
+    // Assign all unassigned rows, returns false if a row cannot be assigned or the budget runs out
+    bool AugmentFreeRows(CostMatrixView<T> &costMatrix);
+    // Check if the budget of the running solve is used up
+    bool IsBudgetExhausted() const;
+    // Remove the assignment of a row, the released col is queued if its potential must be reset
+    void ReleaseRow(int row);
+    // Restore feasible dual potentials and remove the invalid assignments of the dirty rows/cols
+    void RepairDirtyLines(CostMatrixView<T> &costMatrix);
+    // Make the potentials of the unbalanced cols feasible, and zero for the free cols of rectangular problems
+    void BalanceFreeCols(CostMatrixView<T> &costMatrix);
+    // Raise the potential of a free col of a rectangular problem to zero along the shortest alternating path from the
+    // col, the assigned col at the end of the path becomes free instead (O(nrRows * nrCols))
+    void BalanceFreeCol(CostMatrixView<T> &costMatrix, int startCol);
+
+public:
+    AugmentingPathSolver();
+
+    // Solve the assignment problem from scratch, returns false if a row cannot be assigned
+    bool Solve(CostMatrixView<T> &costMatrix);
+    // Register a changed cost of the solved problem (to be called for each changed element)
+    void UpdateCost(int row, int col, T oldCost, T newCost);
+    // Re-solve the problem after cost updates, starting from the last solution
+    bool Resolve(CostMatrixView<T> &costMatrix);
+    // Add or remove rows/cols of the solved problem: previousRows/previousCols hold the row/col of the previous problem
+    // of each row/col (its col/row if isTransposed), -1 for new ones. The assignments and potentials of the kept lines
+    // are kept, and the next Resolve only repairs the lines affected by the change
+    void Resize(const std::vector<int> &previousRows, const std::vector<int> &previousCols, bool isTransposed);
+    // Continue an interrupted solve with the current budget, returns false if a row cannot be assigned
+    bool Continue(CostMatrixView<T> &costMatrix);
+    // Set the budget of the next solves (starts the time limit now)
+    void SetBudget(const SolveBudget &budget);
+    // Check if the last solve stopped because its budget ran out (the solution is partial)
+    bool IsInterrupted() const { return isInterrupted; };
+    // Complete the partial solution of an interrupted solve greedily (each free row gets its cheapest free col) in
+    // completedRowAssignment/completedColAssignment, returns the total cost of the completed assignments and a lower
+    // bound of the optimal total cost from the dual potentials in O(nrFreeRows * nrCols)
+    double CompleteAssignment(CostMatrixView<T> &costMatrix, std::vector<int> &completedRowAssignment, std::vector<int> &completedColAssignment,
+                              double &lowerBound) const;
+    // Set an optimal solution with its dual potentials (e.g. of a similar problem), to be updated and re-solved
+    void SetSolution(const std::vector<int> &rowAssignment, const std::vector<double> &rowPotential, const std::vector<double> &colPotential);
+    // Check if the solver holds a solution which can be used to re-solve the problem
+    bool HasSolution() const { return hasSolution; };
+    // Get the assigned col of each row (-1 if unassigned)
+    const std::vector<int> &GetRowAssignment() const { return rowAssignment; };
+    // Get the assigned row of each col (-1 if unassigned)
+    const std::vector<int> &GetColAssignment() const { return colAssignment; };
+    // Get the dual potentials of the rows
+    const std::vector<double> &GetRowPotential() const { return rowPotential; };
+    // Get the dual potentials of the cols
+    const std::vector<double> &GetColPotential() const { return colPotential; };
+    // Get the number of rows scanned by the shortest path searches of the last (re-)solve
+    long long GetNrOfScannedRows() const { return nrOfScannedRows; };
+    // Set the statistics to which the augmenting paths are added (null if none)
+    void SetStatistics(SolveStatistics *statistics) { this->statistics = statistics; };
+    // Set the thread pool used to scan the cols of large problems (null for a single-threaded solve)
+    void SetThreadPool(ThreadPool *threadPool) { this->threadPool = threadPool; };
+    // Get the number of bytes reserved by the workspace
+    size_t GetWorkspaceSize() const;
+};
+
+#endif // AUGMENTINGPATHSOLVER_H_
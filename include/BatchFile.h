@@ -0,0 +1,251 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#ifndef BATCHFILE_H_
+#define BATCHFILE_H_
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include "CostMatrixView.h"
+
+//----------------------------------------------------------------------------------//
+// Binary container for many cost function matrices, meant to be memory-mapped. All
+// numbers are stored in native (little-endian) byte order:
+//
+//      Header (32 bytes):  char[8] "HUNGBTCH", uint32 version (1), uint32 value type
+//                          (BatchValueType), uint64 number of problems, uint64 offset
+//                          of the index
+//      Payloads:           row-major cost function matrices, each starting at a
+//                          multiple of 8 bytes
+//      Index:              uint64 payload offset, uint32 nrRows, uint32 nrCols for
+//                          each problem
+//
+// The index is written last, so problems can be appended without knowing their number
+// in advance.
+//----------------------------------------------------------------------------------//
+
+//----------------------------------------------------------------------------------//
+// Enumeration for the type of the costs in a batch file
+//
+//  ELEMENTS
+//      BatchInt32:     int costs
+//      BatchFloat32:   float costs
+//      BatchFloat64:   double costs
+//      BatchInt16:     int16_t costs
+//      BatchUInt16:    uint16_t costs (e.g. quantized costs)
+//      BatchInt64:     int64_t costs
+//----------------------------------------------------------------------------------//
+enum BatchValueType
+{
+    BatchInt32,
+    BatchFloat32,
+    BatchFloat64,
+    BatchInt16,
+    BatchUInt16,
+    BatchInt64
+};
+static const char *const BatchValueTypeName[] = {
+    "int",
+    "float",
+    "double",
+    "int16",
+    "uint16",
+    "int64"};
+
+// Value type of a cost type T
+template <typename T>
+struct BatchValueTypeOf;
+template <>
+struct BatchValueTypeOf<int>
+{
+    static const BatchValueType value = BatchValueType::BatchInt32;
+};
+template <>
+struct BatchValueTypeOf<float>
+{
+    static const BatchValueType value = BatchValueType::BatchFloat32;
+};
+template <>
+struct BatchValueTypeOf<double>
+{
+    static const BatchValueType value = BatchValueType::BatchFloat64;
+};
+template <>
+struct BatchValueTypeOf<int16_t>
+{
+    static const BatchValueType value = BatchValueType::BatchInt16;
+};
+template <>
+struct BatchValueTypeOf<uint16_t>
+{
+    static const BatchValueType value = BatchValueType::BatchUInt16;
+};
+template <>
+struct BatchValueTypeOf<int64_t>
+{
+    static const BatchValueType value = BatchValueType::BatchInt64;
+};
+
+//----------------------------------------------------------------------------------//
+// Writes cost function matrices of type T to a batch file. The index is kept in memory
+// (16 bytes per problem) and written by Close().
+//
+// Example:
+//      BatchFileWriter<float> writer("session.hbt");
+//      writer.AddCostFunctionMatrix(costFcnMatrix);
+//      writer.Close();
+//----------------------------------------------------------------------------------//
+template <typename T>
+class BatchFileWriter
+{
+private:
+    // Output file
+    std::ofstream file;
+    // Payload offset and dimensions of each written problem
+    std::vector<uint64_t> payloadOffsets;
+    std::vector<uint32_t> problemRows, problemCols;
+    // Current end of the file
+    uint64_t fileSize;
+
+public:
+    // Create the batch file (an existing file is replaced)
+    explicit BatchFileWriter(const std::string &path);
+    // Close the file if it is still open
+    ~BatchFileWriter();
+    BatchFileWriter(const BatchFileWriter &) = delete;
+    BatchFileWriter &operator=(const BatchFileWriter &) = delete;
+
+    // Append a cost function matrix, returns the index of the problem
+    int AddCostFunctionMatrix(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &costFcnMatrix);
+    // Append a row-major cost function matrix, returns the index of the problem
+    int AddCostFunctionMatrix(const T *rowMajorCosts, int nrRows, int nrCols);
+    // Get the number of written problems
+    int GetNrOfProblems() const { return (int)problemRows.size(); };
+    // Write the index and close the file
+    void Close();
+};
+
+//----------------------------------------------------------------------------------//
+// Read-only memory mapping of a batch file. The costs are used in place (e.g. with
+// HungarianAlgorithm<T>::SetCostFunctionView), so only the pages of the problems being
+// solved have to be in memory. Memory mapping is only supported on POSIX systems.
+//
+// Problems larger than the memory can be solved out of core: ReadRows copies blocks of
+// rows and releases their mapped pages, so with a row-block cost function the solver
+// keeps only its O(nrRows + nrCols) state and the bounded cache of the cost function
+// in memory (nrRows <= nrCols, store the transposed matrix otherwise). GetTotalCost and
+// VerifyOptimality read all rows of the problem once more.
+//
+// Example:
+//      BatchFileReader reader("session.hbt");
+//      const float *costs = reader.GetCosts<float>(0);
+//      problem.SetCostFunctionView(costs, reader.GetNrRows(0), reader.GetNrCols(0), reader.GetNrCols(0), 1);
+//      // or out of core, with at most 1 GB of cached rows:
+//      problem.SetCostFunction(reader.GetNrRows(0), reader.GetNrCols(0), nullptr, reader.GetRowBlockFunction<float>(0), 1 << 30);
+//----------------------------------------------------------------------------------//
+class BatchFileReader
+{
+private:
+    // Mapped file
+    const unsigned char *mappedData;
+    size_t mappedSize;
+    // Type of the costs
+    BatchValueType valueType;
+    // Number of problems in the file
+    int nrProblems;
+    // Start of the index in the mapped file
+    const unsigned char *indexData;
+
+    // Get the payload offset of a problem
+    uint64_t GetPayloadOffset(int problemIdx) const;
+    // Check the problem index
+    void CheckProblemIndex(int problemIdx) const;
+    // Unmap the file (if mapped)
+    void Unmap();
+    // Release the pages holding the bytes [data, data + nrBytes) of the mapped file (pages are read again if used)
+    void ReleasePages(const void *data, size_t nrBytes);
+
+public:
+    // Map the batch file and check its header and index
+    explicit BatchFileReader(const std::string &path);
+    // Unmap the file
+    ~BatchFileReader();
+    BatchFileReader(const BatchFileReader &) = delete;
+    BatchFileReader &operator=(const BatchFileReader &) = delete;
+
+    // Get the type of the costs
+    BatchValueType GetValueType() const { return valueType; };
+    // Get the number of problems
+    int GetNrOfProblems() const { return nrProblems; };
+    // Get the dimensions of a problem
+    int GetNrRows(int problemIdx) const;
+    int GetNrCols(int problemIdx) const;
+    // Get the row-major costs of a problem (T must match the value type of the file)
+    template <typename T>
+    const T *GetCosts(int problemIdx) const
+    {
+        if (BatchValueTypeOf<T>::value != valueType)
+        {
+            throw std::invalid_argument("The cost type does not match the value type of the batch file!");
+        }
+        CheckProblemIndex(problemIdx);
+        return reinterpret_cast<const T *>(mappedData + GetPayloadOffset(problemIdx));
+    }
+    // Copy the rows [firstRow, firstRow + nrRows) of a problem (row-major) and release their mapped pages, so the
+    // copied rows do not stay in memory twice
+    template <typename T>
+    void ReadRows(int problemIdx, int firstRow, int nrRows, T *costs)
+    {
+        const T *problemCosts = GetCosts<T>(problemIdx);
+        if ((firstRow < 0) || (nrRows < 0) || (firstRow + nrRows > GetNrRows(problemIdx)))
+        {
+            throw std::invalid_argument("The rows are out of range of the batch file problem!");
+        }
+        size_t nrCols = GetNrCols(problemIdx);
+        const T *rowCosts = problemCosts + firstRow * nrCols;
+        std::copy(rowCosts, rowCosts + nrRows * nrCols, costs);
+        ReleasePages(rowCosts, nrRows * nrCols * sizeof(T));
+    }
+    // Get a row-block function reading the rows of a problem with ReadRows (see HungarianAlgorithm<T>::SetCostFunction),
+    // the reader must outlive the function
+    template <typename T>
+    CostRowBlockFunction<T> GetRowBlockFunction(int problemIdx)
+    {
+        GetCosts<T>(problemIdx);
+        return [this, problemIdx](int firstRow, int nrRows, T *costs) { ReadRows(problemIdx, firstRow, nrRows, costs); };
+    }
+    // Tell the system that the problems are read sequentially from now on
+    void AdviseSequential();
+    // Release the memory of the problems [firstIdx, lastIdx) which are not needed anymore (pages are read again if used)
+    void ReleaseProblems(int firstIdx, int lastIdx);
+};
+
+#endif // BATCHFILE_H_
@@ -0,0 +1,223 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#ifndef COSTMATRIXVIEW_H_
+#define COSTMATRIXVIEW_H_
+
+#include <Eigen/Dense>
+#include <vector>
+#include <functional>
+#include <stdexcept>
+#include <algorithm>
+#include <limits>
+#include <cstdint>
+#include <type_traits>
+
+// Range of the costs which the solvers handle exactly. The potentials and path costs are computed in double
+// precision, which represents all integers up to 2^53: costs of 8, 16 and 32 bit integer types are always exact,
+// 64-bit integer costs are limited to 2^53, and floating point costs are not limited.
+template <typename T>
+struct CostRange
+{
+    // Set if the largest cost is below the largest value of the type
+    static const bool isLimited = std::is_integral<T>::value && (sizeof(T) > 4);
+    // Largest cost which is handled exactly
+    static T GetMaxCost() { return isLimited ? (T)((int64_t)1 << 53) : std::numeric_limits<T>::max(); }
+};
+
+//----------------------------------------------------------------------------------//
+// Read-only access to the rows of a cost function matrix. The solvers only need one
+// row at a time, which allows the costs to be stored in any layout (or not stored at
+// all) as long as a row can be provided on request.
+//----------------------------------------------------------------------------------//
+template <typename T>
+class CostMatrixView
+{
+public:
+    virtual ~CostMatrixView() {}
+
+    // Number of rows in the viewed matrix
+    virtual int GetNrRows() const = 0;
+    // Number of cols in the viewed matrix
+    virtual int GetNrCols() const = 0;
+    // Get a pointer to the first element of a row, colStride is set to the distance
+    // between two consecutive elements of that row
+    virtual const T *GetRow(int row, Eigen::Index &colStride) = 0;
+};
+
+//----------------------------------------------------------------------------------//
+// View on a dense matrix defined by a data pointer and its strides. Swapping the row
+// and col strides yields the transposed matrix without copying any data.
+//----------------------------------------------------------------------------------//
+template <typename T>
+class DenseCostMatrixView : public CostMatrixView<T>
+{
+private:
+    // Pointer to the first element
+    const T *data;
+    // Dimensions of the viewed matrix
+    int nrRows, nrCols;
+    // Distance between two consecutive rows/cols
+    Eigen::Index rowStride, colStride;
+
+public:
+    DenseCostMatrixView(const T *data, int nrRows, int nrCols, Eigen::Index rowStride, Eigen::Index colStride)
+        : data(data), nrRows(nrRows), nrCols(nrCols), rowStride(rowStride), colStride(colStride) {}
+
+    int GetNrRows() const { return nrRows; }
+    int GetNrCols() const { return nrCols; }
+    const T *GetRow(int row, Eigen::Index &outColStride)
+    {
+        outColStride = colStride;
+        return data + row * rowStride;
+    }
+};
+
+// Function computing the cost of an element (row, col)
+template <typename T>
+using CostFunction = std::function<T(int, int)>;
+// Function computing the costs of nrRows consecutive rows starting at firstRow (row-major, nrRows x nrCols)
+template <typename T>
+using CostRowBlockFunction = std::function<void(int firstRow, int nrRows, T *costs)>;
+
+//----------------------------------------------------------------------------------//
+// View on costs which are computed on demand by a cost function, or by a row-block
+// function which evaluates several rows at once (e.g. vectorized distances). The
+// computed rows are kept in a bounded cache (row r in slot r % nrCacheRows), so the
+// full matrix is never allocated for large problems. Rows which do not fit into the
+// cache are computed again when needed. The transposed view calls costFunction(col,
+// row) and cannot use the row-block function. A returned row stays valid until the
+// next call of GetRow, so the view must not be shared between threads.
+//----------------------------------------------------------------------------------//
+template <typename T>
+class FunctionCostMatrixView : public CostMatrixView<T>
+{
+private:
+    // Dimensions of the viewed matrix
+    int nrRows = 0, nrCols = 0;
+    // Set if element (row, col) of the view is costFunction(col, row)
+    bool transposed = false;
+    // Functions computing the costs
+    CostFunction<T> costFunction;
+    CostRowBlockFunction<T> rowBlockFunction;
+    // Number of rows in the cache, and number of rows computed by one call of the row-block function
+    int nrCacheRows = 0, nrBlockRows = 0;
+    // Cached rows (row-major) and the row held by each slot (-1 if empty)
+    std::vector<T> cache;
+    std::vector<int> cachedRows;
+    // Number of computed costs
+    long long nrOfEvaluations = 0;
+
+    // Compute a row (and the following rows of its block) into the cache
+    void EvaluateRows(int row)
+    {
+        int slot = row % nrCacheRows;
+        T *costs = cache.data() + (size_t)slot * nrCols;
+        int nrEvaluatedRows = 1;
+        if (rowBlockFunction && !transposed)
+        {
+            // The block stays within the cache without wrapping around
+            nrEvaluatedRows = std::min(std::min(nrBlockRows, nrRows - row), nrCacheRows - slot);
+            rowBlockFunction(row, nrEvaluatedRows, costs);
+        }
+        else
+        {
+            for (int col = 0; col < nrCols; col++)
+            {
+                costs[col] = transposed ? costFunction(col, row) : costFunction(row, col);
+            }
+        }
+        nrOfEvaluations += (long long)nrEvaluatedRows * nrCols;
+        for (int idx = 0; idx < nrEvaluatedRows; idx++)
+        {
+            if (std::any_of(costs + (size_t)idx * nrCols, costs + (size_t)(idx + 1) * nrCols, [](T cost) { return cost < 0; }))
+            {
+                std::fill(cachedRows.begin(), cachedRows.end(), -1);
+                throw std::invalid_argument("The cost function matrix cannot contain negative values!");
+            }
+            if (CostRange<T>::isLimited &&
+                std::any_of(costs + (size_t)idx * nrCols, costs + (size_t)(idx + 1) * nrCols, [](T cost) { return cost > CostRange<T>::GetMaxCost(); }))
+            {
+                std::fill(cachedRows.begin(), cachedRows.end(), -1);
+                throw std::invalid_argument("The cost function matrix cannot contain 64-bit integer costs above 2^53!");
+            }
+            cachedRows[slot + idx] = row + idx;
+        }
+    }
+
+public:
+    // Set the cost functions (one of them can be empty) and the size of the cache in bytes (at least one row is cached)
+    void SetCostFunction(int nrRows, int nrCols, bool transposed, const CostFunction<T> &costFunction,
+                         const CostRowBlockFunction<T> &rowBlockFunction, size_t maxCacheBytes, int nrBlockRows)
+    {
+        this->nrRows = nrRows;
+        this->nrCols = nrCols;
+        this->transposed = transposed;
+        this->costFunction = costFunction;
+        this->rowBlockFunction = rowBlockFunction;
+        size_t rowBytes = std::max((size_t)nrCols * sizeof(T), (size_t)1);
+        nrCacheRows = (int)std::max(std::min((size_t)nrRows, maxCacheBytes / rowBytes), (size_t)1);
+        this->nrBlockRows = std::max(1, std::min(nrBlockRows, nrCacheRows));
+        // The cache keeps its capacity for further problems
+        cache.resize((size_t)nrCacheRows * nrCols);
+        cachedRows.assign(nrCacheRows, -1);
+        nrOfEvaluations = 0;
+    }
+    // Release the cost functions and the cache
+    void Release()
+    {
+        costFunction = nullptr;
+        rowBlockFunction = nullptr;
+        std::vector<T>().swap(cache);
+        std::vector<int>().swap(cachedRows);
+    }
+    // Compute a single cost (without the cache)
+    T GetCost(int row, int col)
+    {
+        if (costFunction)
+        {
+            return transposed ? costFunction(col, row) : costFunction(row, col);
+        }
+        Eigen::Index colStride;
+        return GetRow(row, colStride)[col];
+    }
+    // Get the number of costs computed since the cost functions were set
+    long long GetNrOfEvaluations() const { return nrOfEvaluations; }
+
+    int GetNrRows() const { return nrRows; }
+    int GetNrCols() const { return nrCols; }
+    const T *GetRow(int row, Eigen::Index &outColStride)
+    {
+        if (cachedRows[row % nrCacheRows] != row)
+        {
+            EvaluateRows(row);
+        }
+        outColStride = 1;
+        return cache.data() + (size_t)(row % nrCacheRows) * nrCols;
+    }
+};
+
+#endif // COSTMATRIXVIEW_H_
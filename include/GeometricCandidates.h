@@ -0,0 +1,101 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#ifndef GEOMETRICCANDIDATES_H_
+#define GEOMETRICCANDIDATES_H_
+
+#include <Eigen/Dense>
+#include <array>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+#include "CostMatrixView.h"
+#include "SolveStatistics.h"
+
+// Maximum number of dimensions of the points
+#define MAX_GEOMETRIC_DIMS 3
+
+//----------------------------------------------------------------------------------//
+// Candidate pairs of two point sets within a gate distance, with the Euclidean
+// distances as costs, in CSR format for the sparse solvers. The col points are sorted
+// into a uniform grid with cells as large as the gate distance (by sorting their cell
+// coordinates, so empty cells take no memory), and each row point only checks the col
+// points of its own and the neighboring cells. The cells of the last dimension are
+// contiguous in the sorted order, so a row point needs 3^(nrDims - 1) binary searches.
+// The work scales with the number of nearby pairs instead of nrRows * nrCols. Integer
+// cost types get the distances rounded to the nearest integer.
+//
+// Example (2D tracks and detections, gate distance 5):
+//      Eigen::MatrixXf tracks(2, 2), detections(3, 2);
+//      tracks << 0, 0, 10, 10;
+//      detections << 1, 0, 10, 12, 50, 50;
+//      GeometricCandidates<float> candidates;
+//      candidates.Build(tracks, detections, 5);
+//      candidates.GetNrOfCandidates(); // 2: (0, 0) with cost 1, (1, 1) with cost 2
+//----------------------------------------------------------------------------------//
+template <typename T>
+class GeometricCandidates
+{
+private:
+    // Coordinates of a grid cell (unused dimensions are zero)
+    typedef std::array<long long, MAX_GEOMETRIC_DIMS> GridCell;
+
+    // Number of row/col points and their dimension
+    int nrRows = 0, nrCols = 0, nrDims = 0;
+    // Grid cell and index of each col point, sorted by cell
+    std::vector<std::pair<GridCell, int>> sortedColCells;
+    // Candidate pairs in CSR format (cols in increasing order within each row)
+    std::vector<int> rowOffsets, colIndices;
+    std::vector<T> costs;
+    // Candidates (col, cost) of the current row point
+    std::vector<std::pair<int, T>> rowCandidates;
+
+    // Get the grid cell of a point (one point per row of the matrix)
+    GridCell GetCell(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &points, int idx, double cellSize) const;
+
+public:
+    // Find the pairs of row and col points (one point per row of the matrices, 1 to 3 dimensions) whose distance
+    // does not exceed maxDistance
+    void Build(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &rowPoints, const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &colPoints,
+               double maxDistance);
+    // Get the number of row points
+    int GetNrRows() const { return nrRows; };
+    // Get the number of col points
+    int GetNrCols() const { return nrCols; };
+    // Get the number of candidate pairs
+    int GetNrOfCandidates() const { return rowOffsets.empty() ? 0 : rowOffsets[nrRows]; };
+    // Get the offsets of the candidates of each row (nrRows + 1 entries)
+    const int *GetRowOffsets() const { return rowOffsets.data(); };
+    // Get the col of each candidate
+    const int *GetColIndices() const { return colIndices.data(); };
+    // Get the cost (distance) of each candidate
+    const T *GetCosts() const { return costs.data(); };
+    // Get the number of bytes reserved by the workspace
+    size_t GetWorkspaceSize() const;
+};
+
+#endif // GEOMETRICCANDIDATES_H_
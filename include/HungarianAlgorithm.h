@@ -1,134 +1,407 @@
-//----------------------------------------------------------------------------------//
-// MIT License
-//
-// Copyright (c) [2020-] [Mostafa Emam]
-//
-// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-//----------------------------------------------------------------------------------//
-
-#ifndef HUNGARIANALGORITHM_H_
-#define HUNGARIANALGORITHM_H_
-
-#include <Eigen/Dense>
-#include <string>
-#include <cmath>
-#include <vector>
-#include <algorithm>
-#include <stdexcept>
-#include <iomanip>
-#include <map>
-
-// Check if a value is approximately zero (only positive values are expected in the
-// cost function). The macro is better here as it is used for simple values, arrays,
-// and matrices.
-#define IsApproxZERO(X) ((X) <= 1e-6)
-
-//----------------------------------------------------------------------------------//
-// Enumeration for the state of the assignment problem
-//
-//  ELEMENTS
-//      NotReady:       Problem initialized without cost function
-//      ReadyToSolve:   Problem initialized with cost function, ready to solve
-//      Done:           Problem sovled
-//----------------------------------------------------------------------------------//
-enum ProblemStatus
-{
-    NotReady,
-    ReadyToSolve,
-    Done
-};
-static std::map<ProblemStatus, const char *> ProblemStatusName = {
-    {NotReady, "NotReady"},
-    {ReadyToSolve, "ReadyToSolve"},
-    {Done, "Done"}};
-
-//----------------------------------------------------------------------------------//
-// An implementation of the Hungarian algorithm to solve optimal assignment problems.
-// The supported cost function matrix types are <int>, <float>, and <double>, and the
-// result assignment matrix has the type <int>.
-//
-// Example:
-//      Eigen::Matrix3f costFcnMatrix;
-//      costFcnMatrix << 10.5, 22, 18, 42, 5.9, 6, 71.2, 8.4, 69;
-//      auto problem = HungarianAlgorithm<float>(costFcnMatrix);
-//      problem.SolveAssignmentProblem();
-//      Eigen::MatrixXi assignmentMatrix(3, 3);
-//      problem.GetAssignmentMatrix(assignmentMatrix);
-//      std::cout << assignmentMatrix; // [1, 0, 0; 0, 0, 1; 0, 1, 0]
-//----------------------------------------------------------------------------------//
-template <typename T>
-class HungarianAlgorithm
-{
-private:
-    // Dimensions of the cost function matrix
-    int nrRows, nrCols;
-    // Size of the cost function matrix
-    int matrixSize;
-    // Dummy cost to indicate a very large number (Inf)
-    double dummyCost;
-    // Original cost function matrix
-    Eigen::Matrix<T, -1, -1> costFunctionMatrix;
-    // Editable work matrix
-    Eigen::Matrix<T, -1, -1> workingMatrix;
-    // Matrix used to determine the checked/covered elements
-    Eigen::Array<bool, -1, -1> coveredMatrix;
-    // Minimum number of lines needed to cover all the zeroes in the workingMatrix
-    int nrLinesToCoverZeroes;
-    // Assignment matrix
-    Eigen::Array<bool, -1, -1> assignmentMatrix;
-    // Variable to indicate current status
-    ProblemStatus problemStatus = ProblemStatus::NotReady;
-
-    // Step 1: Subtract row minima
-    void SubtractRowMinima();
-    // Step 2: Subtract column minima
-    void SubtractColMinima();
-    // Step 3: Get the minimum number of lines to cover all the zeroes
-    int MinNrOfLinesToCoverAllZeros();
-    // Step 4: Augment the matrix (Create additional zeroes)
-    void AugmentCostFunctionMatrix();
-    // Step 5: Find optimal cost
-    void FindOptimalCost();
-
-public:
-    // Default object constructor, cost function matrix must be set later
-    explicit HungarianAlgorithm();
-    // Create the Hungarian algorithm object using the costFunctionMatrix
-    HungarianAlgorithm(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &costFcnMatrix);
-
-    // Set the cost function matrix
-    void SetCostFunctionMatrix(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &costFcnMatrix);
-    // Get the cost function matrix
-    void GetCostFunctionMatrix(Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &outMatrix);
-    // Get the assignment matrix after solving the problem
-    void GetAssignmentMatrix(Eigen::Matrix<int, Eigen::Dynamic, Eigen::Dynamic> &outMatrix);
-    // Get the assignment indices in two vectors for easy access
-    void GetAssignmentResults(std::vector<int> &idxRow, std::vector<int> &idxCol);
-    // Get current problem status
-    ProblemStatus getProblemStatus() { return problemStatus; };
-    // Get current problem status name
-    std::string getProblemStatusName() { return ProblemStatusName[problemStatus]; };
-
-    // Wrapper to execute all steps of the Hungarian algorithm and solve the assignment problem
-    void SolveAssignmentProblem();
-};
-
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#ifndef HUNGARIANALGORITHM_H_
+#define HUNGARIANALGORITHM_H_
+
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+#include <string>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <iomanip>
+#include <memory>
+#include "AugmentingPathSolver.h"
+#include "SparseDecompositionSolver.h"
+#include "GeometricCandidates.h"
+#include "AuctionSolver.h"
+#include "ThreadPool.h"
+#include "SolveStatistics.h"
+
+//----------------------------------------------------------------------------------//
+// Enumeration for the state of the assignment problem
+//
+//  ELEMENTS
+//      NotReady:       Problem initialized without cost function
+//      ReadyToSolve:   Problem initialized with cost function, ready to solve
+//      Done:           Problem sovled
+//      Interrupted:    Solve stopped by its budget, the best assignment found so far is
+//                      available and the next solve continues from where it stopped
+//----------------------------------------------------------------------------------//
+enum ProblemStatus
+{
+    NotReady,
+    ReadyToSolve,
+    Done,
+    Interrupted
+};
+// Names indexed by the enumeration values (no lookup or allocation needed)
+static const char *const ProblemStatusName[] = {
+    "NotReady",
+    "ReadyToSolve",
+    "Done",
+    "Interrupted"};
+
+//----------------------------------------------------------------------------------//
+// Enumeration for the strategy used to solve the assignment problem
+//
+//  ELEMENTS
+//      Munkres:                Classic step pipeline (reductions, line covers, augments)
+//                              with starred/primed zeros, O(n^3) time and O(n) memory
+//      ShortestAugmentingPath: Jonker-Volgenant shortest augmenting paths with dual
+//                              potentials, O(n^3) time and O(n) additional memory
+//      Auction:                Auction with epsilon-scaling and parallel bidding on
+//                              several threads (optimal for integer costs, within
+//                              n * epsilon of the optimum otherwise)
+//----------------------------------------------------------------------------------//
+enum SolverStrategy
+{
+    Munkres,
+    ShortestAugmentingPath,
+    Auction
+};
+static const char *const SolverStrategyName[] = {
+    "Munkres",
+    "ShortestAugmentingPath",
+    "Auction"};
+
+//----------------------------------------------------------------------------------//
+// An implementation of the Hungarian algorithm to solve optimal assignment problems.
+// The supported cost function matrix types are <int16_t>, <uint16_t>, <int>,
+// <int64_t> (costs up to 2^53), <float>, and <double>, and the result assignment
+// matrix has the type <int>. The problem is solved either with the
+// classic Munkres steps (default) or with shortest augmenting paths, which is much
+// faster for large problems (see SolverStrategy). The costs can be given as a dense
+// matrix, a view on memory of the caller, a sparse matrix, a cost function, or two
+// point sets with a gate distance.
+//
+// Example:
+//      Eigen::Matrix3f costFcnMatrix;
+//      costFcnMatrix << 10.5, 22, 18, 42, 5.9, 6, 71.2, 8.4, 69;
+//      auto problem = HungarianAlgorithm<float>(costFcnMatrix);
+//      problem.SolveAssignmentProblem();
+//      Eigen::MatrixXi assignmentMatrix(3, 3);
+//      problem.GetAssignmentMatrix(assignmentMatrix);
+//      std::cout << assignmentMatrix; // [1, 0, 0; 0, 0, 1; 0, 1, 0]
+//----------------------------------------------------------------------------------//
+// Default size of the cache of computed costs in bytes
+#define DEFAULT_COST_CACHE_BYTES (64 << 20)
+// Number of rows computed by one call of a row-block cost function
+#define COST_FUNCTION_BLOCK_ROWS 64
+
+template <typename T>
+class HungarianAlgorithm
+{
+private:
+    // Dimensions of the cost function matrix
+    int nrRows, nrCols;
+    // Size of the square matrix used by the Munkres steps (missing rows/cols are padded with zero costs)
+    int matrixSize;
+    // Copy of the cost function matrix (in the layout of the input, only grows to avoid reallocations)
+    std::vector<T> costBuffer;
+    // Costs used by the solvers: costBuffer or the memory of a cost function view
+    const T *costData = nullptr;
+    // Distance between the costs of consecutive rows/cols in costData
+    Eigen::Index costRowStride = 1, costColStride = 1;
+    // Set if costData points to memory owned by the user (SetCostFunctionView)
+    bool isCostView = false;
+    // Set if the rows of the Munkres steps are the cols of the cost function matrix, so that the steps scanning
+    // along the cols of the working matrix read contiguous memory
+    bool munkresTransposed = false;
+    // Dimensions and strides of the costs in the orientation of the Munkres steps
+    int munkresNrRows = 0, munkresNrCols = 0;
+    Eigen::Index munkresRowStride = 1, munkresColStride = 1;
+    // Values subtracted from each row/col of the costs by the Munkres steps, the working matrix
+    // (costs - rowReduction - colReduction) is never stored
+    std::vector<double> rowReduction, colReduction;
+    // Masks of the covered rows/cols
+    std::vector<char> coveredRows, coveredCols;
+    // Col of the starred zero in each row, row of the starred zero in each col, and col of the
+    // primed zero in each row (-1 if none)
+    std::vector<int> starredCols, starredRows, primedCols;
+    // Minimum of the working matrix over the uncovered cols for each row, and its col
+    std::vector<double> minUncoveredInRow;
+    std::vector<int> minUncoveredCol;
+    // Number of lines covering the zeroes (always equal to the number of starred zeroes)
+    int nrLinesToCoverZeroes;
+    // Number of iterations of the last solve
+    long long nrOfIterations = 0;
+    // Assignments of the Munkres steps, of sparse problems and the best assignments of interrupted solves (-1 if unassigned)
+    std::vector<int> rowAssignment, colAssignment;
+    // Variable to indicate current status
+    ProblemStatus problemStatus = ProblemStatus::NotReady;
+    // Strategy used to solve the assignment problem
+    SolverStrategy solverStrategy = SolverStrategy::Munkres;
+    // Solver used by the ShortestAugmentingPath strategy
+    AugmentingPathSolver<T> augmentingPathSolver;
+    // Solver used by the Auction strategy
+    AuctionSolver<T> auctionSolver;
+    // Set if the rows of the augmenting path/auction solver are the cols of the cost function matrix
+    bool solverTransposed = false;
+    // Number of threads used by the solvers (0 -> number of hardware threads)
+    int nrThreads = 1;
+    // Pool of threads, created when first needed
+    std::shared_ptr<ThreadPool> threadPool;
+    // Set if the problem was defined by a sparse cost function matrix
+    bool isSparse = false;
+    // Sparse cost function matrix (missing elements are infeasible assignments)
+    Eigen::SparseMatrix<T, Eigen::RowMajor> sparseCostFunctionMatrix;
+    // Transposed sparse cost function matrix, solved instead if nrRows > nrCols (empty otherwise)
+    Eigen::SparseMatrix<T, Eigen::RowMajor> transposedSparseCostFunctionMatrix;
+    // Solver used for sparse cost function matrices (split into connected components)
+    SparseDecompositionSolver<T> sparseSolver;
+    // Candidate pairs of the point sets of geometric problems
+    GeometricCandidates<T> geometricCandidates;
+    // Set if the costs are computed on demand by a cost function
+    bool isCostFunction = false;
+    // View computing and caching the costs of the cost function (solver orientation)
+    FunctionCostMatrixView<T> functionCostView;
+    // Set if the cost function matrix was updated after solving (the previous solution can be reused)
+    bool warmStartPending = false;
+    // Statistics of the last solve (only collected with HUNGARIAN_ENABLE_STATS)
+    SolveStatistics statistics;
+    // Function called for every timed step of a solve (only with HUNGARIAN_ENABLE_STATS)
+    TraceCallback traceCallback;
+    // Dual potentials of the solution and assigned row of each col used by the optimality check
+    std::vector<double> dualRowPotential, dualColPotential;
+    std::vector<int> verifiedColRow;
+    // Row/col of the previous problem of each row/col after adding or removing a line (-1 if new)
+    std::vector<int> rowOrigins, colOrigins;
+    // Greedily completed assignments of an interrupted solve (solver orientation)
+    std::vector<int> completedRowAssignment, completedColAssignment;
+    // Total cost of the best assignments of the interrupted solves, best lower bound of the optimal total cost, and
+    // upper bound of the difference between both
+    double interruptedTotalCost = 0, interruptedLowerBound = 0, optimalityGap = 0;
+
+    // Step 1: Subtract row minima
+    void SubtractRowMinima();
+    // Step 2: Subtract column minima
+    void SubtractColMinima();
+    // Step 3: Get the minimum number of lines to cover all the zeroes
+    int MinNrOfLinesToCoverAllZeros();
+    // Step 4: Augment the matrix (Create additional zeroes)
+    void AugmentCostFunctionMatrix();
+    // Step 5: Find optimal cost
+    void FindOptimalCost();
+    // Get an element of the working matrix of the Munkres steps
+    double GetWorkingElement(int row, int col) const;
+    // Star independent zeros of the reduced working matrix
+    void StarIndependentZeros();
+    // Cover the cols of the starred zeros and find the minima of the uncovered rows
+    void CoverStarredCols();
+    // Star the zeros of the alternating path of primed and starred zeros ending with the primed zero in the row
+    void FlipStarredZeros(int row);
+    // Execute steps 1-5
+    void SolveMunkres();
+    // Alternative to steps 1-5: Solve using shortest augmenting paths
+    void SolveShortestAugmentingPath();
+    // Keep the completed partial solution of an interrupted solve if it is better than the previous one
+    void UpdateInterruptedSolution(CostMatrixView<T> &costView);
+    // Alternative to steps 1-5: Solve using an auction
+    void SolveAuction();
+    // Get the thread pool of the solvers (null if a single thread is used), created when first needed
+    ThreadPool *GetThreadPool();
+    // Run processLines(firstLine, endLine) on chunks of the lines [0, nrLines), on the thread pool for large problems
+    template <typename Function>
+    void ForEachLineChunk(int nrLines, const Function &processLines);
+    // Get the view on the costs used by the augmenting path/auction solvers (nrRows <= nrCols)
+    DenseCostMatrixView<T> GetSolverCostView();
+    // Get a map of the costs without padding
+    Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>, 0, Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>> GetCostMap() const;
+    // Get a cost from costData
+    T GetCost(int row, int col) const { return costData[row * costRowStride + col * costColStride]; };
+    // Get the assigned col of each row or the assigned row of each col from the solver which holds them
+    const int *GetAssignmentData(bool ofCols);
+    // Get the assigned col of a row after solving the problem (-1 if unassigned)
+    int GetAssignedCol(int row) { return GetAssignmentData(false)[row]; };
+    // Check that the costs in memory with row/col strides are valid
+    void CheckCosts(const T *costData, int nrRows, int nrCols, Eigen::Index rowStride, Eigen::Index colStride) const;
+    // Use the costs in memory with row/col strides for the next solve (costBuffer or memory of the caller)
+    void SetCostData(const T *costData, int nrRows, int nrCols, Eigen::Index rowStride, Eigen::Index colStride);
+    // Add (lineCosts with the costs of the line) or remove (lineCosts null) a row or col of the dense costs, the
+    // solution of the ShortestAugmentingPath strategy is kept for the next solve
+    void ChangeLine(bool isRow, int line, const T *lineCosts, int nrLineCosts);
+    // Release a previous sparse problem or cost function
+    void ReleaseSparseProblem();
+    void ReleaseCostFunction();
+    // Get the strategy used for the current problem (cost functions are always solved with shortest augmenting paths)
+    SolverStrategy GetActiveStrategy() const { return isCostFunction ? SolverStrategy::ShortestAugmentingPath : solverStrategy; };
+    // Get the number of bytes reserved by the workspace of the steps and solvers
+    size_t GetWorkspaceSize() const;
+    // Compute the dual potentials of the solution in dualRowPotential and dualColPotential
+    void ComputeDualPotentials();
+    // Get a cost of the dense or sparse cost function matrix (the element must exist)
+    T GetElementCost(int row, int col);
+    // Call visitor(row, col, cost) for all costs of a dense cost function matrix or cost function, the rows of a cost
+    // function (in solver orientation) are computed once each instead of once per element
+    template <typename Visitor>
+    void VisitDenseCosts(const Visitor &visitor);
+
+public:
+    // Default object constructor, cost function matrix must be set later
+    explicit HungarianAlgorithm();
+    // Create the Hungarian algorithm object using the solver strategy, cost function matrix must be set later
+    explicit HungarianAlgorithm(SolverStrategy strategy);
+    // Create the Hungarian algorithm object using the costFunctionMatrix
+    HungarianAlgorithm(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &costFcnMatrix, SolverStrategy strategy = SolverStrategy::Munkres);
+    // Create the Hungarian algorithm object using a row-major costFunctionMatrix
+    template <int Options>
+    HungarianAlgorithm(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Options> &costFcnMatrix, SolverStrategy strategy = SolverStrategy::Munkres)
+        : solverStrategy(strategy)
+    {
+        SetCostFunctionMatrix(costFcnMatrix);
+    }
+
+    // Set the cost function matrix
+    void SetCostFunctionMatrix(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &costFcnMatrix);
+    // Set a row-major cost function matrix, which is copied in its layout without transposing it
+    template <int Options>
+    void SetCostFunctionMatrix(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Options> &costFcnMatrix)
+    {
+        SetCostFunctionMatrix(costFcnMatrix.data(), (int)costFcnMatrix.rows(), (int)costFcnMatrix.cols(), costFcnMatrix.rowStride(), costFcnMatrix.colStride());
+    }
+    // Copy the costs from memory of the caller with row/col strides (in number of elements), e.g. row-major buffers.
+    // The copy keeps the layout (the elements along the smaller stride stay contiguous)
+    void SetCostFunctionMatrix(const T *costData, int nrRows, int nrCols, Eigen::Index rowStride, Eigen::Index colStride);
+    // Use the costs in memory owned by the caller without copying them, the memory must stay valid and unchanged
+    // until the problem is solved (strides in number of elements)
+    void SetCostFunctionView(const T *costData, int nrRows, int nrCols, Eigen::Index rowStride, Eigen::Index colStride);
+    // Use the costs of an existing matrix without copying them (see above)
+    void SetCostFunctionView(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &costFcnMatrix);
+    // Use the costs of an existing row-major matrix without copying them (see above)
+    template <int Options>
+    void SetCostFunctionView(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Options> &costFcnMatrix)
+    {
+        SetCostFunctionView(costFcnMatrix.data(), (int)costFcnMatrix.rows(), (int)costFcnMatrix.cols(), costFcnMatrix.rowStride(), costFcnMatrix.colStride());
+    }
+    // A temporary matrix cannot be used as a view
+    void SetCostFunctionView(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &&costFcnMatrix) = delete;
+    template <int Options>
+    void SetCostFunctionView(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Options> &&costFcnMatrix) = delete;
+    // Set a sparse cost function matrix, missing elements are infeasible (always solved with shortest augmenting paths)
+    void SetCostFunctionMatrix(const Eigen::SparseMatrix<T> &costFcnMatrix);
+    // Set a sparse cost function matrix in CSR format (rowOffsets has nrRows + 1 entries)
+    void SetCostFunctionMatrix(int nrRows, int nrCols, const int *rowOffsets, const int *colIndices, const T *values);
+    // Set the costs as the Euclidean distances between row and col points (one point per row of the matrices, 1 to 3
+    // dimensions), only pairs within maxDistance are feasible. The pairs are found on a grid, and the problem is solved
+    // as a sparse cost function matrix, so the work scales with the number of nearby pairs
+    void SetCostFunctionPoints(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &rowPoints, const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &colPoints,
+                               double maxDistance);
+    // Compute the costs on demand with a cost function (row, col) -> cost and/or a function computing blocks of rows
+    // (row-major), without allocating the full matrix. Computed rows are cached within maxCacheBytes. Cost functions
+    // are always solved with shortest augmenting paths, and problems with more rows than cols need costFunction.
+    void SetCostFunction(int nrRows, int nrCols, const CostFunction<T> &costFunction, const CostRowBlockFunction<T> &rowBlockFunction = nullptr,
+                         size_t maxCacheBytes = DEFAULT_COST_CACHE_BYTES);
+    // Update the costs of a solved problem with a matrix of the same dimensions, the next solve starts from the previous solution
+    void UpdateCostFunctionMatrix(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &costFcnMatrix);
+    // Update a single cost of a solved problem, the next solve starts from the previous solution
+    void UpdateCostFunctionElement(int row, int col, T cost);
+    // Add a row with the costs of all cols after the last row of the costs (dense costs only). A solution of the
+    // ShortestAugmentingPath strategy keeps its assignments and dual potentials, and the next solve only repairs the
+    // rows/cols affected by the change with a few augmentations, O(nrRows * nrCols) per changed row/col
+    void AddRow(const Eigen::Matrix<T, Eigen::Dynamic, 1> &rowCosts);
+    // Add a col with the costs of all rows after the last col of the costs, see AddRow
+    void AddCol(const Eigen::Matrix<T, Eigen::Dynamic, 1> &colCosts);
+    // Remove a row of the costs, the following rows move up by one, see AddRow
+    void RemoveRow(int row);
+    // Remove a col of the costs, the following cols move left by one, see AddRow
+    void RemoveCol(int col);
+    // Get the cost function matrix (outputs are resized to the problem dimensions)
+    void GetCostFunctionMatrix(Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &outMatrix);
+    // Get the assignment matrix after solving the problem (outputs are resized to the problem dimensions)
+    void GetAssignmentMatrix(Eigen::Matrix<int, Eigen::Dynamic, Eigen::Dynamic> &outMatrix);
+    // Get the assignment matrix as a sparse matrix with one element per assignment in O(nrRows + nrCols)
+    void GetAssignmentMatrix(Eigen::SparseMatrix<int> &outMatrix);
+    // Get the assignment indices in two vectors for easy access (outputs are resized to the problem dimensions)
+    void GetAssignmentResults(std::vector<int> &idxRow, std::vector<int> &idxCol);
+    // Get a read-only view on the assigned col of each row (-1 if unassigned) without copying, valid until the
+    // problem is changed or solved again
+    Eigen::Map<const Eigen::VectorXi> GetRowAssignment();
+    // Get a read-only view on the assigned row of each col (-1 if unassigned), see GetRowAssignment
+    Eigen::Map<const Eigen::VectorXi> GetColAssignment();
+    // Get the rows which cannot be assigned to any feasible col (sparse cost function matrices)
+    void GetInfeasibleRows(std::vector<int> &infeasibleRows);
+    // Get the total cost of the assignments after solving the problem
+    double GetTotalCost();
+    // Get the dual potentials of the rows and cols after solving the problem (outputs are resized to the problem
+    // dimensions): rowPotential + colPotential <= cost for all elements with equality for the assignments, the
+    // potentials of the larger dimension are not positive and zero if unassigned, so their sum is the total cost.
+    // Sparse problems only hold the conditions for the stored elements, and their rows/cols of the smaller dimension
+    // which cannot be assigned get zero potentials. The potentials of the Auction strategy satisfy these conditions
+    // only within its final epsilon.
+    void GetDualPotentials(std::vector<double> &rowPotential, std::vector<double> &colPotential);
+    // Check the optimality of the solution with the dual potentials in O(nrRows * nrCols): complementary slackness
+    // and dual feasibility must hold within the tolerance (relative to the largest cost)
+    bool VerifyOptimality(double tolerance = 1e-9);
+    // Get current problem status
+    ProblemStatus getProblemStatus() { return problemStatus; };
+    // Get current problem status name
+    std::string getProblemStatusName() { return ProblemStatusName[problemStatus]; };
+    // Set the strategy used to solve the assignment problem
+    void SetSolverStrategy(SolverStrategy strategy);
+    // Get current solver strategy
+    SolverStrategy getSolverStrategy() { return solverStrategy; };
+    // Get current solver strategy name
+    std::string getSolverStrategyName() { return SolverStrategyName[solverStrategy]; };
+    // Set the number of threads used by the solvers (0 -> number of hardware threads): the reductions and minimum
+    // scans of the Munkres steps, the col scans of the shortest augmenting paths and the bids of the auction are
+    // split on the threads for large problems, with the same results as a single thread
+    void SetNrOfThreads(int nrThreads);
+    // Get the number of threads used by the solvers
+    int getNrOfThreads() { return nrThreads; };
+    // Get the number of iterations of the last solve (Munkres: matrix augmentations, ShortestAugmentingPath and
+    // sparse problems: rows scanned by the shortest path searches, Auction: bidding rounds)
+    long long getNrOfIterations() { return nrOfIterations; };
+    // Set the final bid increment of the Auction strategy for non-integer costs, relative to the largest cost
+    void SetAuctionEpsilon(double epsilon) { auctionSolver.SetRelativeEpsilon(epsilon); };
+    // Set if sparse problems solved on several threads (SetNrOfThreads) are split into the connected components of
+    // their stored elements (default), which are solved in parallel (components with a single row or col are
+    // assigned directly)
+    void SetSparseDecomposition(bool isEnabled) { sparseSolver.SetDecomposition(isEnabled); };
+    // Get the number of connected components of the last sparse solve
+    int getNrOfComponents() { return sparseSolver.GetNrOfComponents(); };
+    // Set a function called with the wall time of every step of the next solves (only with HUNGARIAN_ENABLE_STATS)
+    void SetTraceCallback(const TraceCallback &callback) { traceCallback = callback; };
+    // Get the statistics of the last solve (empty unless built with HUNGARIAN_ENABLE_STATS)
+    const SolveStatistics &getSolveStatistics() { return statistics; };
+    // Get an upper bound of the difference between the total cost of the solution and the optimal total cost (zero
+    // unless the last solve was interrupted)
+    double getOptimalityGap() { return optimalityGap; };
+
+    // Wrapper to execute all steps of the Hungarian algorithm and solve the assignment problem, returns the
+    // statistics of the solve (empty unless built with HUNGARIAN_ENABLE_STATS)
+    const SolveStatistics &SolveAssignmentProblem();
+    // Solve the assignment problem within a budget of time and/or iterations (rows scanned by the shortest path
+    // searches), limited budgets need the ShortestAugmentingPath strategy and dense costs or a cost function. If the
+    // budget runs out, the status is Interrupted and the best assignment found so far (all rows/cols of the smaller
+    // dimension assigned) is reported with its getOptimalityGap(). The next solve of the unchanged problem continues
+    // from where the last one stopped.
+    const SolveStatistics &SolveAssignmentProblem(const SolveBudget &budget);
+};
+
 #endif // HUNGARIANALGORITHM_H_
\ No newline at end of file
@@ -0,0 +1,201 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#ifndef HUNGARIANALGORITHMFIXED_H_
+#define HUNGARIANALGORITHMFIXED_H_
+
+#include <Eigen/Dense>
+#include <array>
+#include <string>
+#include <limits>
+#include <stdexcept>
+#include "HungarianAlgorithm.h"
+
+//----------------------------------------------------------------------------------//
+// Variant of the Hungarian algorithm for tiny square problems with a size N known at
+// compile time (e.g. millions of 3x3 to 8x8 problems). All data lives in fixed-size
+// members on the stack, so no heap memory is allocated, and the loops have constant
+// bounds which the compiler can unroll. The problem is solved with shortest
+// augmenting paths and dual potentials in O(N^3). The class is header-only as it is
+// instantiated for every size N.
+//
+// Example:
+//      Eigen::Matrix3i costFcnMatrix;
+//      costFcnMatrix << 40, 60, 15, 25, 30, 45, 55, 30, 25;
+//      auto problem = HungarianAlgorithmFixed<int, 3>(costFcnMatrix);
+//      problem.SolveAssignmentProblem();
+//      std::array<int, 3> rowIndices, colIndices;
+//      problem.GetAssignmentResults(rowIndices, colIndices); // [2, 0, 1], [1, 2, 0]
+//----------------------------------------------------------------------------------//
+template <typename T, int N>
+class HungarianAlgorithmFixed
+{
+    static_assert((N >= 1) && (N <= 16), "The fixed-size solver is meant for problems up to 16x16!");
+
+private:
+    // Cost function matrix
+    Eigen::Matrix<T, N, N> costFunctionMatrix;
+    // Assigned col of each row, and assigned row of each col
+    std::array<int, N> rowAssignment, colAssignment;
+    // Variable to indicate current status
+    ProblemStatus problemStatus = ProblemStatus::NotReady;
+
+public:
+    // Fixed-size Eigen members may need aligned heap allocation
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    // Default object constructor, cost function matrix must be set later
+    HungarianAlgorithmFixed() {}
+    // Create the Hungarian algorithm object using the costFunctionMatrix
+    explicit HungarianAlgorithmFixed(const Eigen::Matrix<T, N, N> &costFcnMatrix) { SetCostFunctionMatrix(costFcnMatrix); }
+
+    // Set the cost function matrix
+    void SetCostFunctionMatrix(const Eigen::Matrix<T, N, N> &costFcnMatrix)
+    {
+        // Check if the input matrix contains any negative values
+        if ((costFcnMatrix.array() < 0).any())
+        {
+            throw std::invalid_argument("The cost function matrix cannot contain negative values!");
+        }
+        // The potentials are doubles, so 64-bit integer costs must be exact in double precision
+        if (CostRange<T>::isLimited && (costFcnMatrix.maxCoeff() > CostRange<T>::GetMaxCost()))
+        {
+            throw std::invalid_argument("The cost function matrix cannot contain 64-bit integer costs above 2^53!");
+        }
+        costFunctionMatrix = costFcnMatrix;
+        problemStatus = ProblemStatus::ReadyToSolve;
+    }
+    // Get the cost function matrix
+    const Eigen::Matrix<T, N, N> &GetCostFunctionMatrix() const { return costFunctionMatrix; }
+    // Get the assignment matrix after solving the problem
+    void GetAssignmentMatrix(Eigen::Matrix<int, N, N> &outMatrix) const
+    {
+        if (problemStatus != ProblemStatus::Done)
+        {
+            throw std::invalid_argument("The assignment problem has not been solved yet!");
+        }
+        outMatrix.setZero();
+        for (int row = 0; row < N; row++)
+        {
+            outMatrix(row, rowAssignment[row]) = 1;
+        }
+    }
+    // Get the assignment indices in two arrays for easy access
+    void GetAssignmentResults(std::array<int, N> &idxRow, std::array<int, N> &idxCol) const
+    {
+        if (problemStatus != ProblemStatus::Done)
+        {
+            throw std::invalid_argument("The assignment problem has not been solved yet!");
+        }
+        idxRow = rowAssignment;
+        idxCol = colAssignment;
+    }
+    // Get current problem status
+    ProblemStatus getProblemStatus() const { return problemStatus; };
+    // Get current problem status name
+    std::string getProblemStatusName() const { return ProblemStatusName[problemStatus]; };
+
+    // Solve the assignment problem
+    void SolveAssignmentProblem()
+    {
+        if (problemStatus == ProblemStatus::NotReady)
+        {
+            throw std::invalid_argument("The cost function matrix is undefined!");
+        }
+
+        // Index 0 is a virtual col which holds the row to assign in each search
+        std::array<double, N + 1> rowPotential, colPotential, minSlack;
+        std::array<int, N + 1> colRow, pathCol;
+        std::array<bool, N + 1> visitedCol;
+        rowPotential.fill(0);
+        colPotential.fill(0);
+        colRow.fill(0);
+
+        for (int row = 1; row <= N; row++)
+        {
+            // Grow a tree of tight edges from the row until a free col is reached
+            colRow[0] = row;
+            int col = 0;
+            minSlack.fill(std::numeric_limits<double>::infinity());
+            visitedCol.fill(false);
+            do
+            {
+                visitedCol[col] = true;
+                int treeRow = colRow[col];
+                double delta = std::numeric_limits<double>::infinity();
+                int nextCol = 0;
+                for (int idxCol = 1; idxCol <= N; idxCol++)
+                {
+                    if (!visitedCol[idxCol])
+                    {
+                        double slack = (double)costFunctionMatrix(treeRow - 1, idxCol - 1) - rowPotential[treeRow] - colPotential[idxCol];
+                        if (slack < minSlack[idxCol])
+                        {
+                            minSlack[idxCol] = slack;
+                            pathCol[idxCol] = col;
+                        }
+                        if (minSlack[idxCol] < delta)
+                        {
+                            delta = minSlack[idxCol];
+                            nextCol = idxCol;
+                        }
+                    }
+                }
+                // Update the potentials so that the edge to nextCol becomes tight
+                for (int idxCol = 0; idxCol <= N; idxCol++)
+                {
+                    if (visitedCol[idxCol])
+                    {
+                        rowPotential[colRow[idxCol]] += delta;
+                        colPotential[idxCol] -= delta;
+                    }
+                    else
+                    {
+                        minSlack[idxCol] -= delta;
+                    }
+                }
+                col = nextCol;
+            } while (colRow[col] != 0);
+
+            // Flip the assignments along the augmenting path
+            do
+            {
+                int previousCol = pathCol[col];
+                colRow[col] = colRow[previousCol];
+                col = previousCol;
+            } while (col != 0);
+        }
+
+        for (int col = 1; col <= N; col++)
+        {
+            rowAssignment[colRow[col] - 1] = col - 1;
+            colAssignment[col - 1] = colRow[col] - 1;
+        }
+        problemStatus = ProblemStatus::Done;
+    }
+};
+
+#endif // HUNGARIANALGORITHMFIXED_H_
@@ -0,0 +1,101 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#ifndef HUNGARIANBATCHSOLVER_H_
+#define HUNGARIANBATCHSOLVER_H_
+
+#include <Eigen/Dense>
+#include <vector>
+#include <stdexcept>
+#include "AugmentingPathSolver.h"
+#include "ThreadPool.h"
+
+//----------------------------------------------------------------------------------//
+// Solver for batches of many small independent assignment problems. The cost function
+// matrices of mixed sizes are packed one after the other (column-major), solved in
+// parallel on a pool of threads with one reusable solver workspace per thread, and
+// all results are written into a single contiguous buffer. Solving further batches of
+// similar sizes does not allocate any memory.
+//
+// The results of each problem consist of its row indices followed by its col indices,
+// with the same meaning as in HungarianAlgorithm<T>::GetAssignmentResults (-1 for
+// unassigned rows/cols).
+//
+// Example:
+//      HungarianBatchSolver<float> batchSolver(4);
+//      batchSolver.AddCostFunctionMatrix(costFcnMatrix3x3);
+//      batchSolver.AddCostFunctionMatrix(costFcnMatrix5x4);
+//      batchSolver.SolveAssignmentProblems();
+//      std::vector<int> rowIndices(5), colIndices(4);
+//      batchSolver.GetAssignmentResults(1, rowIndices, colIndices);
+//----------------------------------------------------------------------------------//
+template <typename T>
+class HungarianBatchSolver
+{
+private:
+    // Packed cost function matrices added to the batch
+    std::vector<T> packedCosts;
+    // Dimensions of each problem in the batch
+    std::vector<int> problemRows, problemCols;
+    // Offsets of each problem in the packed costs and in the results
+    std::vector<size_t> costOffsets, resultOffsets;
+    // Number of rows of each solved problem
+    std::vector<int> solvedRows;
+    // Row indices followed by col indices of each problem
+    std::vector<int> assignmentResults;
+    // Pool of threads used to solve the problems
+    ThreadPool threadPool;
+    // Reusable solver workspace of each thread
+    std::vector<AugmentingPathSolver<T>> threadSolvers;
+
+    // Solve a single problem of the batch on the given thread
+    void SolveProblem(const T *costs, int nrRows, int nrCols, int *results, int threadIdx);
+
+public:
+    // Create the batch solver with a total number of threads (0 -> number of hardware threads)
+    explicit HungarianBatchSolver(int nrThreads = 0);
+
+    // Add a cost function matrix to the batch, returns the index of the problem
+    int AddCostFunctionMatrix(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &costFcnMatrix);
+    // Remove all problems from the batch (the allocated memory is kept for the next batch)
+    void Clear();
+    // Get the number of problems in the batch
+    int GetNrOfProblems() { return (int)problemRows.size(); };
+
+    // Solve all problems added to the batch
+    void SolveAssignmentProblems();
+    // Solve externally packed problems, nrRows[idx] x nrCols[idx] column-major matrices stored one after the other
+    void SolveAssignmentProblems(const T *packedCostFcnMatrices, const int *nrRows, const int *nrCols, int nrProblems);
+
+    // Get the results of all solved problems (row indices followed by col indices of each problem)
+    const std::vector<int> &GetAssignmentResults() { return assignmentResults; };
+    // Get the offset of the results of a problem in the results buffer
+    size_t GetAssignmentResultsOffset(int problemIdx) { return resultOffsets[problemIdx]; };
+    // Get the assignment indices of a single problem in two vectors for easy access (resized to the problem dimensions)
+    void GetAssignmentResults(int problemIdx, std::vector<int> &rowIndices, std::vector<int> &colIndices);
+};
+
+#endif // HUNGARIANBATCHSOLVER_H_
@@ -0,0 +1,140 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#ifndef HUNGARIANSOLVERSERVICE_H_
+#define HUNGARIANSOLVERSERVICE_H_
+
+#include <Eigen/Dense>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <functional>
+#include <chrono>
+#include <exception>
+#include <stdexcept>
+#include "HungarianAlgorithm.h"
+
+// Results of a problem solved by the service
+struct AssignmentResult
+{
+    // Assignment indices as in HungarianAlgorithm<T>::GetAssignmentResults (-1 if unassigned)
+    std::vector<int> rowIndices, colIndices;
+    // Total cost of the assignments
+    double totalCost = 0;
+};
+
+// Function called with the results of a problem, or with the exception thrown while solving it
+typedef std::function<void(const AssignmentResult &result, std::exception_ptr error)> AssignmentCallback;
+
+// Metrics of the service since its creation (times in milliseconds)
+struct SolverServiceMetrics
+{
+    // Number of submitted, completed (including failed), failed and rejected (queue full) problems
+    long long nrSubmitted = 0, nrCompleted = 0, nrFailed = 0, nrRejected = 0;
+    // Current and largest number of problems waiting in the queue, and problems being solved or delivered
+    int queueDepth = 0, maxQueueDepth = 0, nrActive = 0;
+    // Mean and largest time spent in the queue, and from submission to completion
+    double meanQueueTimeMs = 0, maxQueueTimeMs = 0, meanLatencyMs = 0, maxLatencyMs = 0;
+};
+
+//----------------------------------------------------------------------------------//
+// Thread-safe service which solves assignment problems asynchronously, e.g. to keep
+// the solves off the frame thread of a perception pipeline. The cost function matrices
+// are queued and solved by a fixed number of worker threads, each of which owns a
+// reusable HungarianAlgorithm<T> instance, so repeated solves of similar sizes do not
+// allocate solver memory. The results are delivered through a future or a callback
+// (called on the worker thread). The queue is bounded: Submit blocks while it is full
+// (back-pressure), and TrySubmit rejects the problem instead.
+//
+// Example:
+//      HungarianSolverService<float> service(4, 64, SolverStrategy::ShortestAugmentingPath);
+//      std::future<AssignmentResult> future = service.Submit(costFcnMatrix);
+//      ... // Other work of the frame
+//      AssignmentResult result = future.get();
+//----------------------------------------------------------------------------------//
+template <typename T>
+class HungarianSolverService
+{
+private:
+    // Queued problem with the destination of its results
+    struct Request
+    {
+        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> costFcnMatrix;
+        // Results are delivered to the callback if set, otherwise to the promise
+        std::promise<AssignmentResult> promise;
+        AssignmentCallback callback;
+        std::chrono::steady_clock::time_point submitTime;
+    };
+
+    // Maximum number of queued problems
+    size_t maxQueueSize;
+    // Worker threads and the solver of each worker
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<HungarianAlgorithm<T>>> solvers;
+    // Queued problems
+    std::deque<Request> queue;
+    // Protects the queue, the metrics and the stopping flag
+    std::mutex mutex;
+    std::condition_variable queueNotEmpty, queueNotFull, serviceIdle;
+    // Set when the service is destroyed
+    bool stopping;
+    // Metrics, with the sums of the times for the means
+    SolverServiceMetrics metrics;
+    double totalQueueTimeMs, totalLatencyMs;
+
+    // Main function of the worker threads
+    void WorkerLoop(int workerIdx);
+    // Queue a request, waiting for space if requested, returns false if the queue is full
+    bool Enqueue(Request &request, bool waitForSpace);
+
+public:
+    // Create the service with a number of worker threads (0 -> number of hardware threads), the maximum number of
+    // queued problems, and the strategy used by the solvers
+    explicit HungarianSolverService(int nrThreads = 0, int maxQueueSize = 256, SolverStrategy strategy = SolverStrategy::ShortestAugmentingPath);
+    // Solve the queued problems and stop the workers
+    ~HungarianSolverService();
+    HungarianSolverService(const HungarianSolverService &) = delete;
+    HungarianSolverService &operator=(const HungarianSolverService &) = delete;
+
+    // Queue a problem (waits while the queue is full), the future holds the results or the thrown exception
+    std::future<AssignmentResult> Submit(Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> costFcnMatrix);
+    // Queue a problem (waits while the queue is full), the callback is called on a worker thread
+    void Submit(Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> costFcnMatrix, const AssignmentCallback &callback);
+    // Queue a problem without waiting, returns false (and counts a rejection) if the queue is full
+    bool TrySubmit(Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> costFcnMatrix, std::future<AssignmentResult> &future);
+    // Wait until all submitted problems are solved and their results are delivered
+    void WaitUntilIdle();
+    // Get the number of worker threads
+    int GetNrOfThreads() const { return (int)workers.size(); };
+    // Get a snapshot of the metrics
+    SolverServiceMetrics GetMetrics();
+};
+
+#endif // HUNGARIANSOLVERSERVICE_H_
@@ -0,0 +1,153 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#ifndef KBESTASSIGNMENTSOLVER_H_
+#define KBESTASSIGNMENTSOLVER_H_
+
+#include <Eigen/Dense>
+#include <vector>
+#include <memory>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include "AugmentingPathSolver.h"
+#include "ThreadPool.h"
+
+//----------------------------------------------------------------------------------//
+// Finds the K assignments with the lowest costs in ranked order (Murty's algorithm).
+// The solution space is partitioned by the assignments of the best solution: child i
+// keeps the assignments of the first i rows and forbids the assignment of row i.
+// Each child starts from the solution and dual potentials of its parent, so only the
+// forbidden row is released and assigned again by one shortest augmenting path
+// (O(nrRows * nrCols) instead of a full solve). Children whose lower bound (parent
+// cost + smallest reduced cost of the released row) cannot beat the K-th best known
+// solution are not solved. The children of a node can be solved on several threads,
+// the results do not depend on the number of threads.
+//
+// Example:
+//      KBestAssignmentSolver<float> solver;
+//      solver.SetCostFunctionMatrix(costFcnMatrix);
+//      solver.SolveKBestAssignments(10);
+//      for (int idx = 0; idx < solver.GetNrOfSolutions(); idx++)
+//      {
+//          solver.GetAssignmentResults(idx, rowIndices, colIndices);
+//          double cost = solver.GetTotalCost(idx);
+//      }
+//----------------------------------------------------------------------------------//
+template <typename T>
+class KBestAssignmentSolver
+{
+private:
+    // Sub-problem of the partition with its optimal solution
+    struct Node
+    {
+        // Total cost of the solution
+        double cost;
+        // Order of creation, resolves ties of the cost
+        long long sequence;
+        // Optimal solution (solver orientation) and its dual potentials
+        std::vector<int> rowAssignment;
+        std::vector<double> rowPotential, colPotential;
+        // Assignments (row, col) which are forced or forbidden in the sub-problem
+        std::vector<std::pair<int, int>> forcedElements, forbiddenElements;
+    };
+    // View on the costs of a sub-problem in double precision, the forbidden assignments get an infinite cost (which
+    // integer types cannot represent, so their largest value would still be a feasible assignment)
+    class ConstrainedCostMatrixView : public CostMatrixView<double>
+    {
+    private:
+        // Costs of the full problem
+        DenseCostMatrixView<T> costView;
+        // Forced col of each row and forced row of each col (-1 if none)
+        std::vector<int> forcedColOfRow, forcedRowOfCol;
+        // Mask of the forbidden elements (row-major) and the list of set elements
+        std::vector<char> forbiddenMask;
+        std::vector<std::pair<int, int>> maskedElements;
+        // Costs of the last requested row
+        std::vector<double> rowCosts;
+
+    public:
+        explicit ConstrainedCostMatrixView(const DenseCostMatrixView<T> &costView);
+        // Set the constraints of a sub-problem
+        void SetConstraints(const std::vector<std::pair<int, int>> &forcedElements, const std::vector<std::pair<int, int>> &forbiddenElements);
+        // Check if an element is allowed by the constraints
+        bool IsAllowed(int row, int col) const;
+        // Get a cost of the full problem
+        double GetCost(int row, int col);
+
+        int GetNrRows() const { return costView.GetNrRows(); }
+        int GetNrCols() const { return costView.GetNrCols(); }
+        const double *GetRow(int row, Eigen::Index &colStride);
+    };
+    // Workspace of a thread
+    struct ThreadWorkspace
+    {
+        AugmentingPathSolver<double> solver;
+        std::unique_ptr<ConstrainedCostMatrixView> costView;
+    };
+
+    // Dimensions of the cost function matrix
+    int nrRows, nrCols;
+    // Copy of the cost function matrix (column-major)
+    std::vector<T> costs;
+    // Set if the solver works on the transposed matrix (nrRows > nrCols)
+    bool solverTransposed;
+    // Found solutions in ranked order (solver orientation) and their costs
+    std::vector<std::vector<int>> solutions;
+    std::vector<double> solutionCosts;
+    // Number of solved and pruned sub-problems of the last search
+    long long nrOfSolvedProblems, nrOfPrunedProblems;
+    // Pool of threads and the workspace of each thread
+    ThreadPool threadPool;
+    std::vector<ThreadWorkspace> threadWorkspaces;
+
+    // Get the view on the costs in solver orientation (nrRows <= nrCols)
+    DenseCostMatrixView<T> GetSolverCostView() const;
+    // Solve a child of a node which forces the first rows of freeRows and forbids the assignment of freeRows[idxChild],
+    // returns null if the child is infeasible or cannot be better than the threshold
+    std::unique_ptr<Node> SolveChild(const Node &parent, const std::vector<int> &freeRows, int idxChild, double threshold, ThreadWorkspace &workspace);
+
+public:
+    // Create the solver with a total number of threads for the sub-problems (0 -> number of hardware threads)
+    explicit KBestAssignmentSolver(int nrThreads = 1);
+
+    // Set the cost function matrix
+    void SetCostFunctionMatrix(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &costFcnMatrix);
+    // Find up to k assignments with the lowest costs, returns the number of found assignments
+    int SolveKBestAssignments(int k);
+    // Get the number of found assignments
+    int GetNrOfSolutions() const { return (int)solutions.size(); };
+    // Get the total cost of a found assignment (ranked by cost, starting with the optimal one)
+    double GetTotalCost(int solutionIdx) const;
+    // Get the assignment indices of a found assignment (outputs are resized to the problem dimensions)
+    void GetAssignmentResults(int solutionIdx, std::vector<int> &rowIndices, std::vector<int> &colIndices) const;
+    // Get the number of sub-problems solved by the last search
+    long long GetNrOfSolvedProblems() const { return nrOfSolvedProblems; };
+    // Get the number of sub-problems skipped by the last search (infeasible or due to their lower bound)
+    long long GetNrOfPrunedProblems() const { return nrOfPrunedProblems; };
+};
+
+#endif // KBESTASSIGNMENTSOLVER_H_
@@ -0,0 +1,207 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#ifndef SOLVESTATISTICS_H_
+#define SOLVESTATISTICS_H_
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------------------//
+// The statistics and trace events of a solve are only collected if the library is
+// built with HUNGARIAN_ENABLE_STATS (CMake option of the same name). Otherwise the
+// instrumentation compiles to nothing and the returned statistics stay empty.
+//----------------------------------------------------------------------------------//
+#ifdef HUNGARIAN_ENABLE_STATS
+#define HUNGARIAN_STATS(...) __VA_ARGS__
+#else
+#define HUNGARIAN_STATS(...)
+#endif
+
+//----------------------------------------------------------------------------------//
+// Enumeration for the timed steps of a solve
+//
+//  ELEMENTS
+//      SolveAssignmentProblemStep:             Complete solve (contains the other steps)
+//      SubtractRowMinimaStep ... FindOptimalCostStep:
+//                                              Munkres steps
+//      ShortestAugmentingPathStep:             Solve with the ShortestAugmentingPath strategy
+//      AuctionStep:                            Solve with the Auction strategy
+//      SparseShortestAugmentingPathStep:       Solve of a sparse cost function matrix
+//----------------------------------------------------------------------------------//
+enum SolveStep
+{
+    SolveAssignmentProblemStep,
+    SubtractRowMinimaStep,
+    SubtractColMinimaStep,
+    StarIndependentZerosStep,
+    MinNrOfLinesToCoverAllZerosStep,
+    AugmentCostFunctionMatrixStep,
+    FindOptimalCostStep,
+    ShortestAugmentingPathStep,
+    AuctionStep,
+    SparseShortestAugmentingPathStep,
+    NrOfSolveSteps
+};
+static const char *const SolveStepName[] = {
+    "SolveAssignmentProblem",
+    "SubtractRowMinima",
+    "SubtractColMinima",
+    "StarIndependentZeros",
+    "MinNrOfLinesToCoverAllZeros",
+    "AugmentCostFunctionMatrix",
+    "FindOptimalCost",
+    "ShortestAugmentingPath",
+    "Auction",
+    "SparseShortestAugmentingPath"};
+
+//----------------------------------------------------------------------------------//
+// Statistics of the last solve of an assignment problem (all zero if not enabled)
+//----------------------------------------------------------------------------------//
+struct SolveStatistics
+{
+    // Set if the statistics were collected (built with HUNGARIAN_ENABLE_STATS)
+    bool isEnabled = false;
+    // Wall time of each step in seconds, summed over all its calls
+    double stepTime[NrOfSolveSteps] = {};
+    // Number of calls of each step
+    long long nrOfStepCalls[NrOfSolveSteps] = {};
+    // Number of iterations (see HungarianAlgorithm::getNrOfIterations)
+    long long nrOfIterations = 0;
+    // Number of uncovered zeros which were primed and covered (Munkres)
+    long long nrOfCoveredZeros = 0;
+    // Number of augmenting paths, and their total and longest length in assignments
+    long long nrOfAugmentingPaths = 0;
+    long long totalAugmentingPathLength = 0;
+    int maxAugmentingPathLength = 0;
+    // Number of bytes by which the workspace of the solvers grew
+    long long nrOfBytesAllocated = 0;
+
+    // Add an augmenting path which changed the given number of assignments
+    void AddAugmentingPath(int pathLength)
+    {
+        nrOfAugmentingPaths++;
+        totalAugmentingPathLength += pathLength;
+        maxAugmentingPathLength = (pathLength > maxAugmentingPathLength) ? pathLength : maxAugmentingPathLength;
+    }
+};
+
+//----------------------------------------------------------------------------------//
+// Timed step, passed to the trace callback when the step ends
+//----------------------------------------------------------------------------------//
+struct TraceEvent
+{
+    // Step and its name
+    SolveStep step;
+    const char *name;
+    // Start time (steady clock) and duration in microseconds
+    double startTime, duration;
+    // Hash of the id of the thread which executed the step
+    size_t threadId;
+};
+// Function called for every timed step (nested steps end before the step containing them)
+typedef std::function<void(const TraceEvent &)> TraceCallback;
+
+//----------------------------------------------------------------------------------//
+// Measures the wall time of a step from construction to destruction, adds it to the
+// statistics and passes it to the trace callback (if any).
+//----------------------------------------------------------------------------------//
+class SolveStepTimer
+{
+private:
+    SolveStatistics &statistics;
+    SolveStep step;
+    const TraceCallback &traceCallback;
+    std::chrono::steady_clock::time_point startTime;
+
+public:
+    SolveStepTimer(SolveStatistics &statistics, SolveStep step, const TraceCallback &traceCallback)
+        : statistics(statistics), step(step), traceCallback(traceCallback), startTime(std::chrono::steady_clock::now()) {}
+    ~SolveStepTimer()
+    {
+        std::chrono::steady_clock::time_point endTime = std::chrono::steady_clock::now();
+        statistics.stepTime[step] += std::chrono::duration<double>(endTime - startTime).count();
+        statistics.nrOfStepCalls[step]++;
+        if (traceCallback)
+        {
+            TraceEvent event;
+            event.step = step;
+            event.name = SolveStepName[step];
+            event.startTime = std::chrono::duration<double, std::micro>(startTime.time_since_epoch()).count();
+            event.duration = std::chrono::duration<double, std::micro>(endTime - startTime).count();
+            event.threadId = std::hash<std::thread::id>()(std::this_thread::get_id());
+            traceCallback(event);
+        }
+    }
+    SolveStepTimer(const SolveStepTimer &) = delete;
+    SolveStepTimer &operator=(const SolveStepTimer &) = delete;
+};
+
+//----------------------------------------------------------------------------------//
+// Collects trace events (from any number of problems and threads) and writes them in
+// the Chrome trace event format, which can be opened in chrome://tracing or Perfetto.
+//
+// Example:
+//      ChromeTraceRecorder recorder;
+//      problem.SetTraceCallback(recorder.GetCallback());
+//      problem.SolveAssignmentProblem();
+//      std::ofstream file("trace.json");
+//      recorder.WriteJson(file);
+//----------------------------------------------------------------------------------//
+class ChromeTraceRecorder
+{
+private:
+    // Recorded events
+    std::vector<TraceEvent> events;
+    // Protects the events against concurrent solves
+    mutable std::mutex eventsMutex;
+
+public:
+    // Add an event
+    void Record(const TraceEvent &event);
+    // Get a callback which records the events (the recorder must outlive its use)
+    TraceCallback GetCallback();
+    // Get the number of recorded events
+    size_t GetNrOfEvents() const;
+    // Remove all recorded events
+    void Clear();
+    // Write the recorded events as Chrome trace JSON
+    void WriteJson(std::ostream &stream) const;
+};
+
+// Get the number of bytes reserved by vectors
+inline size_t GetCapacityBytes() { return 0; }
+template <typename V, typename... Vectors>
+size_t GetCapacityBytes(const V &vector, const Vectors &...vectors)
+{
+    return vector.capacity() * sizeof(typename V::value_type) + GetCapacityBytes(vectors...);
+}
+
+#endif // SOLVESTATISTICS_H_
@@ -0,0 +1,128 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#ifndef SPARSEAUGMENTINGPATHSOLVER_H_
+#define SPARSEAUGMENTINGPATHSOLVER_H_
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include "SolveStatistics.h"
+
+//----------------------------------------------------------------------------------//
+// Shortest augmenting path solver for sparse assignment problems given in compressed
+// sparse row (CSR) format. Only the stored elements are allowed assignments, missing
+// elements are infeasible. The shortest paths are found with a binary heap, so the
+// work and memory scale with the number of stored elements instead of nrRows * nrCols.
+//
+// Each row owns an additional slack col with a cost larger than any complete
+// assignment, so the solver first maximizes the number of assigned rows and then
+// minimizes the total cost. Rows which end up on their slack col cannot be assigned
+// to any allowed col and are reported as unassigned (-1).
+//
+// Example (2x3 matrix, row 0 allows cols 0 and 2, row 1 allows col 0 only):
+//      int rowOffsets[] = {0, 2, 3}, colIndices[] = {0, 2, 0};
+//      float values[] = {1.5, 4, 2};
+//      SparseAugmentingPathSolver<float> solver;
+//      solver.Solve(2, 3, rowOffsets, colIndices, values);
+//      solver.GetAssignedCol(0); // 2
+//----------------------------------------------------------------------------------//
+template <typename T>
+class SparseAugmentingPathSolver
+{
+private:
+    // Entry of the heap used to find the closest col
+    struct HeapEntry
+    {
+        double cost;
+        bool assigned;
+        int col;
+        // Order for a min-heap, ties are resolved in favor of unassigned cols
+        bool operator<(const HeapEntry &other) const
+        {
+            return (cost > other.cost) || ((cost == other.cost) && (assigned > other.assigned));
+        }
+    };
+
+    // Dimensions of the solved problem
+    int nrRows, nrCols;
+    // Cost of the slack col of each row (larger than the cost of any complete assignment)
+    double slackCost;
+    // Dual potentials of the rows and the cols (the slack col of a row is at nrCols + row)
+    std::vector<double> rowPotential, colPotential;
+    // Assigned col of each row and assigned row of each col (-1 if unassigned)
+    std::vector<int> rowAssignment, colAssignment;
+    // Cost of the shortest path to each col found in the current search
+    std::vector<double> shortestPathCosts;
+    // Previous row of each col on the shortest path tree
+    std::vector<int> pathRow;
+    // Cols which are part of the current shortest path tree
+    std::vector<char> visitedCols;
+    // Cols reached and rows visited by the current search (to reset only what was used)
+    std::vector<int> reachedCols, visitedRows;
+    // Heap of the reached cols ordered by their path cost
+    std::vector<HeapEntry> heap;
+    // Cost of the last found shortest augmenting path
+    double minPathCost;
+    // Number of rows scanned by the searches of the last solve
+    long long nrOfScannedRows;
+    // Statistics of the running solve (only used with HUNGARIAN_ENABLE_STATS)
+    SolveStatistics *statistics;
+
+    // Find the shortest augmenting path starting at a free row, returns the free col at its end
+    int FindShortestAugmentingPath(const int *rowOffsets, const int *colIndices, const T *values, int startRow);
+    // Update the dual potentials and flip the assignments along the found path
+    void AugmentPath(int startRow, int sinkCol);
+    // Relax the path cost of a col reached through a row
+    void RelaxCol(int row, int col, double cost);
+
+public:
+    SparseAugmentingPathSolver();
+
+    // Solve the assignment problem given in CSR format (rowOffsets has nrRows + 1 entries)
+    void Solve(int nrRows, int nrCols, const int *rowOffsets, const int *colIndices, const T *values);
+    // Get the assigned col of a row (-1 if the row cannot be assigned)
+    int GetAssignedCol(int row) const { return (rowAssignment[row] < nrCols) ? rowAssignment[row] : -1; };
+    // Get the assigned row of a col (-1 if unassigned)
+    int GetAssignedRow(int col) const { return colAssignment[col]; };
+    // Get the assigned row of each col (-1 if unassigned), the slack cols follow the real cols
+    const std::vector<int> &GetColAssignment() const { return colAssignment; };
+    // Get the dual potential of a row
+    double GetRowPotential(int row) const { return rowPotential[row]; };
+    // Get the dual potential of a col (slack cols follow the real cols)
+    double GetColPotential(int col) const { return colPotential[col]; };
+    // Get the number of rows which cannot be assigned
+    int GetNrOfUnassignedRows() const;
+    // Get the number of rows scanned by the shortest path searches of the last solve
+    long long GetNrOfScannedRows() const { return nrOfScannedRows; };
+    // Set the statistics to which the augmenting paths are added (null if none)
+    void SetStatistics(SolveStatistics *statistics) { this->statistics = statistics; };
+    // Get the number of bytes reserved by the workspace
+    size_t GetWorkspaceSize() const;
+};
+
+#endif // SPARSEAUGMENTINGPATHSOLVER_H_
@@ -0,0 +1,133 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#ifndef SPARSEDECOMPOSITIONSOLVER_H_
+#define SPARSEDECOMPOSITIONSOLVER_H_
+
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include "SparseAugmentingPathSolver.h"
+#include "ThreadPool.h"
+#include "SolveStatistics.h"
+
+//----------------------------------------------------------------------------------//
+// Solver for sparse assignment problems in CSR format which splits the problem into
+// independent subproblems to solve them in parallel. Rows and cols are connected by
+// their stored (feasible) elements, and each connected component is an assignment
+// problem of its own. Components with a single row or a single col are assigned
+// directly to their cheapest element (forced assignments), the others are solved with
+// shortest augmenting paths on local CSR copies on the thread pool. The results are
+// written back in the original row/col indexing and are the same for any number of
+// threads. Without several threads (or decomposition), the whole problem is solved at
+// once: the searches of a single thread only visit the component of their row anyway,
+// so splitting the problem would only add the cost of the copies.
+//
+// Example (row 0 only allows col 1, rows 1-2 share cols 0 and 2):
+//      int rowOffsets[] = {0, 1, 3, 5}, colIndices[] = {1, 0, 2, 0, 2};
+//      float values[] = {3, 1, 4, 2, 6};
+//      SparseDecompositionSolver<float> solver;
+//      ThreadPool threadPool(2);
+//      solver.Solve(3, 3, rowOffsets, colIndices, values, &threadPool);
+//      solver.GetNrOfComponents(); // 2
+//      solver.GetAssignedCol(1); // 2
+//----------------------------------------------------------------------------------//
+template <typename T>
+class SparseDecompositionSolver
+{
+private:
+    // Local CSR copy of a component and the solver of one thread
+    struct ComponentWorkspace
+    {
+        SparseAugmentingPathSolver<T> solver;
+        std::vector<int> rowOffsets, colIndices;
+        std::vector<T> values;
+    };
+
+    // Dimensions of the solved problem
+    int nrRows = 0, nrCols = 0;
+    // Set if the problem is split into its connected components
+    bool isDecompositionEnabled = true;
+    // Parent of each node in the union-find forest (rows first, then cols), and the component of each node
+    std::vector<int> parentNodes, nodeComponents;
+    // Rows/cols of each component, grouped by component (in increasing order within a component)
+    std::vector<int> componentRowOffsets, componentRows, componentColOffsets, componentCols;
+    // Number of stored elements of each component, and the components solved with shortest augmenting paths
+    std::vector<long long> componentElements;
+    std::vector<int> solvedComponents;
+    // Index of each col within its component
+    std::vector<int> localCols;
+    // Number of rows scanned by the searches of each solved component
+    std::vector<long long> componentScannedRows;
+    // Workspace of each thread
+    std::vector<ComponentWorkspace> workspaces;
+    // Assigned col of each row and assigned row of each col (-1 if unassigned)
+    std::vector<int> rowAssignment, colAssignment;
+    // Dual potentials of the rows and the cols
+    std::vector<double> rowPotential, colPotential;
+    // Number of components and of forced assignments of the last solve
+    int nrOfComponents = 0, nrOfForcedAssignments = 0;
+    // Number of rows scanned by the searches of the last solve
+    long long nrOfScannedRows = 0;
+    // Statistics of the running solve (only used with HUNGARIAN_ENABLE_STATS)
+    SolveStatistics *statistics = nullptr;
+
+    // Find the root of a node in the union-find forest (with path halving)
+    int FindRoot(int node);
+    // Group the rows and cols by their connected component
+    void FindComponents(const int *rowOffsets, const int *colIndices);
+    // Assign the single row or the single col of a component to its cheapest element
+    void AssignForcedComponent(int component, const int *rowOffsets, const int *colIndices, const T *values);
+    // Solve a component on the workspace of a thread and copy its results
+    void SolveComponent(int component, const int *rowOffsets, const int *colIndices, const T *values, ComponentWorkspace &workspace);
+
+public:
+    // Set if the problem is split into its connected components on a thread pool (default), otherwise it is solved at once
+    void SetDecomposition(bool isEnabled) { isDecompositionEnabled = isEnabled; };
+    // Solve the assignment problem given in CSR format (rowOffsets has nrRows + 1 entries), the components are
+    // solved on the thread pool (the whole problem is solved at once without a pool of several threads)
+    void Solve(int nrRows, int nrCols, const int *rowOffsets, const int *colIndices, const T *values, ThreadPool *threadPool);
+    // Get the assigned col of a row (-1 if the row cannot be assigned)
+    int GetAssignedCol(int row) const { return rowAssignment[row]; };
+    // Get the assigned row of each col (-1 if unassigned)
+    const std::vector<int> &GetColAssignment() const { return colAssignment; };
+    // Get the dual potential of a row
+    double GetRowPotential(int row) const { return rowPotential[row]; };
+    // Get the dual potential of a col
+    double GetColPotential(int col) const { return colPotential[col]; };
+    // Get the number of connected components of the last solve (1 without decomposition)
+    int GetNrOfComponents() const { return nrOfComponents; };
+    // Get the number of rows assigned without a search in the last solve
+    int GetNrOfForcedAssignments() const { return nrOfForcedAssignments; };
+    // Get the number of rows scanned by the shortest path searches of the last solve
+    long long GetNrOfScannedRows() const { return nrOfScannedRows; };
+    // Set the statistics to which the augmenting paths are added (null if none), only used without decomposition
+    void SetStatistics(SolveStatistics *statistics) { this->statistics = statistics; };
+    // Get the number of bytes reserved by the workspace
+    size_t GetWorkspaceSize() const;
+};
+
+#endif // SPARSEDECOMPOSITIONSOLVER_H_
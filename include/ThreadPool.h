@@ -0,0 +1,97 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#ifndef THREADPOOL_H_
+#define THREADPOOL_H_
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <exception>
+
+//----------------------------------------------------------------------------------//
+// Fixed pool of worker threads to run the iterations of a loop in parallel. The
+// calling thread takes part in the work as thread 0, so a pool of 1 thread runs
+// everything sequentially without any synchronization. The threads are kept alive
+// between calls to avoid the cost of creating them for every loop, and they poll for
+// the next loop for a short time before sleeping, so short loops started one after the
+// other (e.g. the scans of a single large problem) are not slowed down by waking the
+// threads. Loops started from different threads at the same time are executed one
+// after the other.
+//
+// Example:
+//      ThreadPool threadPool(4);
+//      threadPool.ParallelFor(100, [&](int idx, int threadIdx) { work[idx] = ...; });
+//----------------------------------------------------------------------------------//
+class ThreadPool
+{
+private:
+    // Worker threads (the calling thread is not included)
+    std::vector<std::thread> workers;
+    // Synchronization of the workers with the calling thread
+    std::mutex mutex;
+    // Serializes loops started from different threads
+    std::mutex loopMutex;
+    std::condition_variable taskCondition, doneCondition;
+    // Current loop body and number of iterations
+    const std::function<void(int, int)> *task;
+    int nrTasks;
+    // Next iteration to be executed
+    std::atomic<int> nextTask;
+    // Number of workers still running the current loop
+    std::atomic<int> nrBusyWorkers;
+    // Incremented for every loop, so that the workers can detect new work
+    std::atomic<unsigned int> generation;
+    // Set when the pool is destroyed
+    std::atomic<bool> stopping;
+    // Number of workers sleeping on taskCondition, and set if the calling thread sleeps on doneCondition
+    int nrSleepingWorkers;
+    bool isCallerWaiting;
+    // First exception thrown by the loop body (rethrown by ParallelFor)
+    std::exception_ptr taskException;
+
+    // Main function of the worker threads
+    void WorkerLoop(int threadIdx);
+    // Execute loop iterations until none are left
+    void RunTasks(int threadIdx);
+
+public:
+    // Create the pool with a total number of threads (0 -> number of hardware threads)
+    explicit ThreadPool(int nrThreads = 0);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    // Get the total number of threads (including the calling thread)
+    int GetNrThreads() const { return (int)workers.size() + 1; };
+    // Run task(idx, threadIdx) for all idx in [0, nrTasks) and wait for completion, threadIdx is in [0, GetNrThreads())
+    void ParallelFor(int nrTasks, const std::function<void(int, int)> &task);
+};
+
+#endif // THREADPOOL_H_
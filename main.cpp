@@ -1,256 +1,2330 @@
-//----------------------------------------------------------------------------------//
-// MIT License
-//
-// Copyright (c) [2020-] [Mostafa Emam]
-//
-// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-//----------------------------------------------------------------------------------//
-
-#include <iostream>
-#include "HungarianAlgorithm.h"
-
-bool test3x3Matrix();
-bool test4x4Matrix(HungarianAlgorithm<float> &hungAlgProblem);
-bool test5x4Matrix(HungarianAlgorithm<float> &hungAlgProblem);
-
-int main(int argc, const char *argv[])
-{
-    // Specify and run some simple tests
-    std::vector<int> bTestsPassedVector = {false, false, false};
-    // Test 3x3 <int> matrix
-    bTestsPassedVector[0] = test3x3Matrix();
-    // Create an object and use it to test 4x4 and 5x4 <float> matrices
-    auto hungAlgProblem = HungarianAlgorithm<float>();
-    bTestsPassedVector[1] = test4x4Matrix(hungAlgProblem);
-    bTestsPassedVector[2] = test5x4Matrix(hungAlgProblem);
-
-    // Add final info message
-    if (bTestsPassedVector[0] && bTestsPassedVector[1] && bTestsPassedVector[2])
-    {
-        std::cout << "SUCCESS: All tests passed successfully!\n";
-    }
-    else
-    {
-        std::cout << "ERROR: An error occurred during the execution of one of the tests!\n";
-    }
-    return 0;
-};
-
-bool test3x3Matrix()
-{
-    bool testPassed = true;
-    std::cout << "[Testing 3x3 Matrix]\n";
-
-    // Create and initialize the cost function matrix
-    Eigen::Matrix3i costFcnMatrix;
-    costFcnMatrix << 40, 60, 15,
-        25, 30, 45,
-        55, 30, 25;
-    std::cout << "Cost Matrix:\n"
-              << costFcnMatrix << "\n";
-    // Initialize the Hungarian algorithm object with the costFcnMatrix
-    auto hungAlgProblem = HungarianAlgorithm<int>(costFcnMatrix);
-    // Solve the assignment problem
-    hungAlgProblem.SolveAssignmentProblem();
-
-    // Get the assignment results
-    Eigen::MatrixXi assignmentMatrix(3, 3);
-    hungAlgProblem.GetAssignmentMatrix(assignmentMatrix);
-    std::cout << "Assignment Matrix:\n"
-              << assignmentMatrix << "\n";
-    // Compare to the expected results
-    Eigen::Matrix3i expectedMatrix;
-    expectedMatrix << 0, 0, 1,
-        1, 0, 0,
-        0, 1, 0;
-    if (assignmentMatrix == expectedMatrix)
-    {
-        std::cout << "Correct assignment for 3x3 problem\n";
-    }
-    else
-    {
-        testPassed = false;
-        std::cout << "ERROR: Incorrect assignment for 3x3 problem!\n";
-    }
-
-    // Also check the assignment indices as vectors
-    std::vector<int> rowIndices(3), columnIndices(3);
-    hungAlgProblem.GetAssignmentResults(rowIndices, columnIndices);
-    // Compare to the expected results
-    std::vector<int> checkRowIndices = {2, 0, 1};
-    std::vector<int> checkColIndices = {1, 2, 0};
-    if (rowIndices == checkRowIndices)
-    {
-        std::cout << "Correct row indexing for 3x3 problem\n";
-    }
-    else
-    {
-        testPassed = false;
-        std::cout << "ERROR: Incorrect row indexing for 3x3 problem!\n";
-    }
-    if (columnIndices == checkColIndices)
-    {
-        std::cout << "Correct col indexing for 3x3 problem\n";
-    }
-    else
-    {
-        testPassed = false;
-        std::cout << "ERROR: Incorrect col indexing for 3x3 problem!\n";
-    }
-    std::cout << "----------\n";
-    return testPassed;
-}
-
-bool test4x4Matrix(HungarianAlgorithm<float> &hungAlgProblem)
-{
-    bool testPassed = true;
-    std::cout << "[Testing 4x4 Matrix]\n";
-
-    // Create and initialize the cost function matrix
-    Eigen::Matrix4f costFcnMatrix;
-    costFcnMatrix << 4.9, 2.6, 5.2, 7.8,
-        8.1, 3.2, 10.1, 8.3,
-        12.8, 5.3, 4.5, 5.1,
-        6.2, 3.1, 7.9, 14.5;
-    std::cout << "Cost Matrix:\n"
-              << costFcnMatrix << "\n";
-    // Assign the cost function to the Hungarian algorithm object
-    hungAlgProblem.SetCostFunctionMatrix(costFcnMatrix);
-    // Solve the assignment problem
-    hungAlgProblem.SolveAssignmentProblem();
-
-    // Get the assignment results
-    Eigen::MatrixXi assignmentMatrix(4, 4);
-    hungAlgProblem.GetAssignmentMatrix(assignmentMatrix);
-    std::cout << "Assignment Matrix:\n"
-              << assignmentMatrix << "\n";
-    // Compare to the expected results
-    Eigen::Matrix4i expectedMatrix;
-    expectedMatrix << 0, 0, 1, 0,
-        0, 1, 0, 0,
-        0, 0, 0, 1,
-        1, 0, 0, 0;
-    if (assignmentMatrix == expectedMatrix)
-    {
-        std::cout << "Correct assignment for 4x4 problem\n";
-    }
-    else
-    {
-        testPassed = false;
-        std::cout << "ERROR: Incorrect assignment for 4x4 problem!\n";
-    }
-
-    // Also check the assignment indices as vectors
-    std::vector<int> rowIndices(4), columnIndices(4);
-    hungAlgProblem.GetAssignmentResults(rowIndices, columnIndices);
-    // Compare to the expected results
-    std::vector<int> checkRowIndices = {2, 1, 3, 0};
-    std::vector<int> checkColIndices = {3, 1, 0, 2};
-    if (rowIndices == checkRowIndices)
-    {
-        std::cout << "Correct row indexing for 4x4 problem\n";
-    }
-    else
-    {
-        testPassed = false;
-        std::cout << "ERROR: Incorrect row indexing for 4x4 problem!\n";
-    }
-    if (columnIndices == checkColIndices)
-    {
-        std::cout << "Correct col indexing for 4x4 problem\n";
-    }
-    else
-    {
-        testPassed = false;
-        std::cout << "ERROR: Incorrect col indexing for 4x4 problem!\n";
-    }
-    std::cout << "----------\n";
-    return testPassed;
-}
-
-bool test5x4Matrix(HungarianAlgorithm<float> &hungAlgProblem)
-{
-    bool testPassed = true;
-    std::cout << "[Testing 5x4 Matrix]\n";
-
-    // Create and initialize the cost function matrix
-    Eigen::MatrixXf costFcnMatrix(5, 4);
-    costFcnMatrix << 18, 11, 16.9, 22,
-        14, 19, 26, 18,
-        21, 23, 35, 29,
-        42, 27, 21, 17,
-        16, 15, 28, 25;
-    std::cout << "Cost Matrix:\n"
-              << costFcnMatrix << "\n";
-    // Assign the cost function to the Hungarian algorithm object
-    hungAlgProblem.SetCostFunctionMatrix(costFcnMatrix);
-    // Solve the assignment problem
-    hungAlgProblem.SolveAssignmentProblem();
-
-    // Get the assignment results
-    Eigen::MatrixXi assignmentMatrix(5, 4);
-    hungAlgProblem.GetAssignmentMatrix(assignmentMatrix);
-    std::cout << "Assignment Matrix:\n"
-              << assignmentMatrix << "\n";
-    // Compare to the expected results
-    Eigen::Matrix<int, 5, 4> expectedMatrix;
-    expectedMatrix << 0, 0, 1, 0,
-        1, 0, 0, 0,
-        0, 0, 0, 0,
-        0, 0, 0, 1,
-        0, 1, 0, 0;
-    if (assignmentMatrix == expectedMatrix)
-    {
-        std::cout << "Correct assignment for 5x4 problem\n";
-    }
-    else
-    {
-        testPassed = false;
-        std::cout << "ERROR: Incorrect assignment for 5x4 problem!\n";
-    }
-
-    // Also check the assignment indices as vectors
-    std::vector<int> rowIndices(5), columnIndices(4);
-    hungAlgProblem.GetAssignmentResults(rowIndices, columnIndices);
-    // Compare to the expected results, -1 to indicate an unused (undefined) index
-    std::vector<int> checkRowIndices = {2, 0, -1, 3, 1};
-    std::vector<int> checkColIndices = {1, 4, 0, 3};
-    if (rowIndices == checkRowIndices)
-    {
-        std::cout << "Correct row indexing for 5x4 problem\n";
-    }
-    else
-    {
-        testPassed = false;
-        std::cout << "ERROR: Incorrect row indexing for 5x4 problem!\n";
-    }
-    if (columnIndices == checkColIndices)
-    {
-        std::cout << "Correct col indexing for 5x4 problem\n";
-    }
-    else
-    {
-        testPassed = false;
-        std::cout << "ERROR: Incorrect col indexing for 5x4 problem!\n";
-    }
-    std::cout << "----------\n";
-    return testPassed;
-}
\ No newline at end of file
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#include <iostream>
+#include <random>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <numeric>
+#include <set>
+#include "HungarianAlgorithm.h"
+#include "HungarianBatchSolver.h"
+#include "HungarianAlgorithmFixed.h"
+#include "BatchFile.h"
+#include "KBestAssignmentSolver.h"
+#include "HungarianSolverService.h"
+
+bool test3x3Matrix();
+bool test4x4Matrix(HungarianAlgorithm<float> &hungAlgProblem);
+bool test5x4Matrix(HungarianAlgorithm<float> &hungAlgProblem);
+bool testMunkresRandom();
+bool testShortestAugmentingPath();
+bool testBatchSolver();
+bool testWarmStart();
+bool testSparseMatrix();
+bool testAuction();
+bool testFixedSize();
+bool testAllocationFree();
+bool testSolveStatistics();
+bool testDualPotentials();
+bool testBatchFile();
+bool testCostFunction();
+bool testKBestAssignments();
+bool testAssignmentViews();
+bool testParallelSolve();
+bool testSolverService();
+bool testCostTypes();
+bool testRowMajorInput();
+bool testOutOfCore();
+bool testSparseDecomposition();
+bool testBudgetedSolve();
+bool testGeometricAssignment();
+bool testDynamicLines();
+template <int N>
+bool testFixedSizeRandom(std::mt19937 &randomGenerator);
+double totalCost(const Eigen::MatrixXd &costFcnMatrix, const std::vector<int> &rowIndices);
+double bruteForceCost(const Eigen::MatrixXd &costFcnMatrix);
+
+// Number of heap allocations of the program (see operator new below)
+static std::atomic<long> nrOfAllocations(0);
+
+int main(int /*argc*/, const char * /*argv*/[])
+{
+    // Specify and run some simple tests
+    std::vector<int> bTestsPassedVector;
+    // Test 3x3 <int> matrix
+    bTestsPassedVector.push_back(test3x3Matrix());
+    // Create an object and use it to test 4x4 and 5x4 <float> matrices
+    auto hungAlgProblem = HungarianAlgorithm<float>();
+    bTestsPassedVector.push_back(test4x4Matrix(hungAlgProblem));
+    bTestsPassedVector.push_back(test5x4Matrix(hungAlgProblem));
+    // Compare the default strategy to a brute-force search
+    bTestsPassedVector.push_back(testMunkresRandom());
+    // Repeat the tests with the other solver strategies
+    bTestsPassedVector.push_back(testShortestAugmentingPath());
+    // Test solving many problems at once
+    bTestsPassedVector.push_back(testBatchSolver());
+    // Test re-solving after cost updates
+    bTestsPassedVector.push_back(testWarmStart());
+    // Test sparse problems with infeasible assignments
+    bTestsPassedVector.push_back(testSparseMatrix());
+    // Test the auction strategy on one and several threads
+    bTestsPassedVector.push_back(testAuction());
+    // Test the fixed-size variant for tiny problems
+    bTestsPassedVector.push_back(testFixedSize());
+    // Test that repeated solves do not allocate memory
+    bTestsPassedVector.push_back(testAllocationFree());
+    // Test the statistics and trace events of a solve
+    bTestsPassedVector.push_back(testSolveStatistics());
+    // Test the total cost, dual potentials and optimality check
+    bTestsPassedVector.push_back(testDualPotentials());
+    // Test writing and memory-mapping batch files
+    bTestsPassedVector.push_back(testBatchFile());
+    // Test costs computed on demand
+    bTestsPassedVector.push_back(testCostFunction());
+    // Test the K best assignments
+    bTestsPassedVector.push_back(testKBestAssignments());
+    // Test the views on the assignments
+    bTestsPassedVector.push_back(testAssignmentViews());
+    // Test multi-threaded solves of single problems
+    bTestsPassedVector.push_back(testParallelSolve());
+    // Test the asynchronous solver service
+    bTestsPassedVector.push_back(testSolverService());
+    // Test the narrow and wide cost types
+    bTestsPassedVector.push_back(testCostTypes());
+    // Test row-major and strided cost function matrices
+    bTestsPassedVector.push_back(testRowMajorInput());
+    // Test solving problems from a file in row blocks
+    bTestsPassedVector.push_back(testOutOfCore());
+    // Test splitting sparse problems into independent components
+    bTestsPassedVector.push_back(testSparseDecomposition());
+    // Test solves interrupted by a budget and continued later
+    bTestsPassedVector.push_back(testBudgetedSolve());
+    // Test assignments of point sets within a gate distance
+    bTestsPassedVector.push_back(testGeometricAssignment());
+    // Test adding and removing rows/cols of solved problems
+    bTestsPassedVector.push_back(testDynamicLines());
+
+    // Add final info message
+    if (std::all_of(bTestsPassedVector.begin(), bTestsPassedVector.end(), [](int bTestPassed) { return bTestPassed; }))
+    {
+        std::cout << "SUCCESS: All tests passed successfully!\n";
+    }
+    else
+    {
+        std::cout << "ERROR: An error occurred during the execution of one of the tests!\n";
+    }
+    return 0;
+};
+
+bool test3x3Matrix()
+{
+    bool testPassed = true;
+    std::cout << "[Testing 3x3 Matrix]\n";
+
+    // Create and initialize the cost function matrix
+    Eigen::Matrix3i costFcnMatrix;
+    costFcnMatrix << 40, 60, 15,
+        25, 30, 45,
+        55, 30, 25;
+    std::cout << "Cost Matrix:\n"
+              << costFcnMatrix << "\n";
+    // Initialize the Hungarian algorithm object with the costFcnMatrix
+    auto hungAlgProblem = HungarianAlgorithm<int>(costFcnMatrix);
+    // Solve the assignment problem
+    hungAlgProblem.SolveAssignmentProblem();
+
+    // Get the assignment results
+    Eigen::MatrixXi assignmentMatrix(3, 3);
+    hungAlgProblem.GetAssignmentMatrix(assignmentMatrix);
+    std::cout << "Assignment Matrix:\n"
+              << assignmentMatrix << "\n";
+    // Compare to the expected results
+    Eigen::Matrix3i expectedMatrix;
+    expectedMatrix << 0, 0, 1,
+        1, 0, 0,
+        0, 1, 0;
+    if (assignmentMatrix == expectedMatrix)
+    {
+        std::cout << "Correct assignment for 3x3 problem\n";
+    }
+    else
+    {
+        testPassed = false;
+        std::cout << "ERROR: Incorrect assignment for 3x3 problem!\n";
+    }
+
+    // Also check the assignment indices as vectors
+    std::vector<int> rowIndices(3), columnIndices(3);
+    hungAlgProblem.GetAssignmentResults(rowIndices, columnIndices);
+    // Compare to the expected results
+    std::vector<int> checkRowIndices = {2, 0, 1};
+    std::vector<int> checkColIndices = {1, 2, 0};
+    if (rowIndices == checkRowIndices)
+    {
+        std::cout << "Correct row indexing for 3x3 problem\n";
+    }
+    else
+    {
+        testPassed = false;
+        std::cout << "ERROR: Incorrect row indexing for 3x3 problem!\n";
+    }
+    if (columnIndices == checkColIndices)
+    {
+        std::cout << "Correct col indexing for 3x3 problem\n";
+    }
+    else
+    {
+        testPassed = false;
+        std::cout << "ERROR: Incorrect col indexing for 3x3 problem!\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool test4x4Matrix(HungarianAlgorithm<float> &hungAlgProblem)
+{
+    bool testPassed = true;
+    std::cout << "[Testing 4x4 Matrix]\n";
+
+    // Create and initialize the cost function matrix
+    Eigen::Matrix4f costFcnMatrix;
+    costFcnMatrix << 4.9, 2.6, 5.2, 7.8,
+        8.1, 3.2, 10.1, 8.3,
+        12.8, 5.3, 4.5, 5.1,
+        6.2, 3.1, 7.9, 14.5;
+    std::cout << "Cost Matrix:\n"
+              << costFcnMatrix << "\n";
+    // Assign the cost function to the Hungarian algorithm object
+    hungAlgProblem.SetCostFunctionMatrix(costFcnMatrix);
+    // Solve the assignment problem
+    hungAlgProblem.SolveAssignmentProblem();
+
+    // Get the assignment results
+    Eigen::MatrixXi assignmentMatrix(4, 4);
+    hungAlgProblem.GetAssignmentMatrix(assignmentMatrix);
+    std::cout << "Assignment Matrix:\n"
+              << assignmentMatrix << "\n";
+    // Compare to the expected results
+    Eigen::Matrix4i expectedMatrix;
+    expectedMatrix << 0, 0, 1, 0,
+        0, 1, 0, 0,
+        0, 0, 0, 1,
+        1, 0, 0, 0;
+    if (assignmentMatrix == expectedMatrix)
+    {
+        std::cout << "Correct assignment for 4x4 problem\n";
+    }
+    else
+    {
+        testPassed = false;
+        std::cout << "ERROR: Incorrect assignment for 4x4 problem!\n";
+    }
+
+    // Also check the assignment indices as vectors
+    std::vector<int> rowIndices(4), columnIndices(4);
+    hungAlgProblem.GetAssignmentResults(rowIndices, columnIndices);
+    // Compare to the expected results
+    std::vector<int> checkRowIndices = {2, 1, 3, 0};
+    std::vector<int> checkColIndices = {3, 1, 0, 2};
+    if (rowIndices == checkRowIndices)
+    {
+        std::cout << "Correct row indexing for 4x4 problem\n";
+    }
+    else
+    {
+        testPassed = false;
+        std::cout << "ERROR: Incorrect row indexing for 4x4 problem!\n";
+    }
+    if (columnIndices == checkColIndices)
+    {
+        std::cout << "Correct col indexing for 4x4 problem\n";
+    }
+    else
+    {
+        testPassed = false;
+        std::cout << "ERROR: Incorrect col indexing for 4x4 problem!\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool test5x4Matrix(HungarianAlgorithm<float> &hungAlgProblem)
+{
+    bool testPassed = true;
+    std::cout << "[Testing 5x4 Matrix]\n";
+
+    // Create and initialize the cost function matrix
+    Eigen::MatrixXf costFcnMatrix(5, 4);
+    costFcnMatrix << 18, 11, 16.9, 22,
+        14, 19, 26, 18,
+        21, 23, 35, 29,
+        42, 27, 21, 17,
+        16, 15, 28, 25;
+    std::cout << "Cost Matrix:\n"
+              << costFcnMatrix << "\n";
+    // Assign the cost function to the Hungarian algorithm object
+    hungAlgProblem.SetCostFunctionMatrix(costFcnMatrix);
+    // Solve the assignment problem
+    hungAlgProblem.SolveAssignmentProblem();
+
+    // Get the assignment results
+    Eigen::MatrixXi assignmentMatrix(5, 4);
+    hungAlgProblem.GetAssignmentMatrix(assignmentMatrix);
+    std::cout << "Assignment Matrix:\n"
+              << assignmentMatrix << "\n";
+    // Compare to the expected results
+    Eigen::Matrix<int, 5, 4> expectedMatrix;
+    expectedMatrix << 0, 0, 1, 0,
+        1, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 1,
+        0, 1, 0, 0;
+    if (assignmentMatrix == expectedMatrix)
+    {
+        std::cout << "Correct assignment for 5x4 problem\n";
+    }
+    else
+    {
+        testPassed = false;
+        std::cout << "ERROR: Incorrect assignment for 5x4 problem!\n";
+    }
+
+    // Also check the assignment indices as vectors
+    std::vector<int> rowIndices(5), columnIndices(4);
+    hungAlgProblem.GetAssignmentResults(rowIndices, columnIndices);
+    // Compare to the expected results, -1 to indicate an unused (undefined) index
+    std::vector<int> checkRowIndices = {2, 0, -1, 3, 1};
+    std::vector<int> checkColIndices = {1, 4, 0, 3};
+    if (rowIndices == checkRowIndices)
+    {
+        std::cout << "Correct row indexing for 5x4 problem\n";
+    }
+    else
+    {
+        testPassed = false;
+        std::cout << "ERROR: Incorrect row indexing for 5x4 problem!\n";
+    }
+    if (columnIndices == checkColIndices)
+    {
+        std::cout << "Correct col indexing for 5x4 problem\n";
+    }
+    else
+    {
+        testPassed = false;
+        std::cout << "ERROR: Incorrect col indexing for 5x4 problem!\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+bool testMunkresRandom()
+{
+    bool testPassed = true;
+    std::cout << "[Testing Munkres strategy on random problems]\n";
+
+    // Compare the total costs to a brute-force search on random problems of different shapes (with many ties)
+    std::mt19937 randomGenerator(9);
+    std::uniform_int_distribution<int> costDistribution(0, 5);
+    for (int idxProblem = 0; idxProblem < 50; idxProblem++)
+    {
+        int nrRows = 1 + idxProblem % 7;
+        int nrCols = 1 + (idxProblem / 7) % 7;
+        Eigen::MatrixXd randomCostFcnMatrix(nrRows, nrCols);
+        for (int idx = 0; idx < randomCostFcnMatrix.size(); idx++)
+        {
+            randomCostFcnMatrix(idx) = costDistribution(randomGenerator);
+        }
+
+        auto problem = HungarianAlgorithm<double>(randomCostFcnMatrix);
+        problem.SolveAssignmentProblem();
+        std::vector<int> rowIndices, columnIndices;
+        problem.GetAssignmentResults(rowIndices, columnIndices);
+        if (totalCost(randomCostFcnMatrix, rowIndices) != bruteForceCost(randomCostFcnMatrix))
+        {
+            testPassed = false;
+            std::cout << "ERROR: Non-optimal assignment for random " << nrRows << "x" << nrCols << " problem!\n";
+        }
+    }
+    if (testPassed)
+    {
+        std::cout << "Correct assignments for Munkres strategy\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool testShortestAugmentingPath()
+{
+    bool testPassed = true;
+    std::cout << "[Testing ShortestAugmentingPath strategy]\n";
+
+    // The same problems solved with the default strategy must yield the same results
+    auto hungAlgProblem = HungarianAlgorithm<float>(SolverStrategy::ShortestAugmentingPath);
+    testPassed &= test4x4Matrix(hungAlgProblem);
+    testPassed &= test5x4Matrix(hungAlgProblem);
+
+    // Wide problems are solved without padding, unassigned cols are indicated by -1
+    Eigen::MatrixXf costFcnMatrix(2, 4);
+    costFcnMatrix << 9, 3, 7, 8,
+        4, 2, 9, 1;
+    hungAlgProblem.SetCostFunctionMatrix(costFcnMatrix);
+    hungAlgProblem.SolveAssignmentProblem();
+    std::vector<int> rowIndices(2), columnIndices(4);
+    hungAlgProblem.GetAssignmentResults(rowIndices, columnIndices);
+    if ((rowIndices != std::vector<int>{1, 3}) || (columnIndices != std::vector<int>{-1, 0, -1, 1}))
+    {
+        testPassed = false;
+        std::cout << "ERROR: Incorrect indexing for 2x4 problem!\n";
+    }
+
+    // Compare the total costs to a brute-force search on random problems of different shapes
+    std::mt19937 randomGenerator(42);
+    std::uniform_int_distribution<int> costDistribution(0, 50);
+    for (int idxProblem = 0; idxProblem < 50; idxProblem++)
+    {
+        int nrRows = 1 + idxProblem % 7;
+        int nrCols = 1 + (idxProblem / 7) % 7;
+        Eigen::MatrixXd randomCostFcnMatrix(nrRows, nrCols);
+        for (int idx = 0; idx < randomCostFcnMatrix.size(); idx++)
+        {
+            randomCostFcnMatrix(idx) = costDistribution(randomGenerator);
+        }
+
+        auto problem = HungarianAlgorithm<double>(randomCostFcnMatrix, SolverStrategy::ShortestAugmentingPath);
+        problem.SolveAssignmentProblem();
+        rowIndices.resize(nrRows);
+        columnIndices.resize(nrCols);
+        problem.GetAssignmentResults(rowIndices, columnIndices);
+        if (totalCost(randomCostFcnMatrix, rowIndices) != bruteForceCost(randomCostFcnMatrix))
+        {
+            testPassed = false;
+            std::cout << "ERROR: Non-optimal assignment for random " << nrRows << "x" << nrCols << " problem!\n";
+        }
+    }
+    if (testPassed)
+    {
+        std::cout << "Correct assignments for ShortestAugmentingPath strategy\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool testBatchSolver()
+{
+    bool testPassed = true;
+    std::cout << "[Testing batch solver]\n";
+
+    // Create a batch of random problems of mixed sizes
+    std::mt19937 randomGenerator(7);
+    std::uniform_real_distribution<float> costDistribution(0, 100);
+    std::vector<Eigen::MatrixXf> costFcnMatrices;
+    HungarianBatchSolver<float> batchSolver(4);
+    for (int idxProblem = 0; idxProblem < 200; idxProblem++)
+    {
+        Eigen::MatrixXf costFcnMatrix(1 + idxProblem % 6, 1 + (idxProblem / 6) % 6);
+        for (int idx = 0; idx < costFcnMatrix.size(); idx++)
+        {
+            costFcnMatrix(idx) = costDistribution(randomGenerator);
+        }
+        costFcnMatrices.push_back(costFcnMatrix);
+        batchSolver.AddCostFunctionMatrix(costFcnMatrix);
+    }
+    batchSolver.SolveAssignmentProblems();
+
+    // Compare the results of each problem to a brute-force search
+    for (int idxProblem = 0; idxProblem < batchSolver.GetNrOfProblems(); idxProblem++)
+    {
+        const Eigen::MatrixXd costFcnMatrix = costFcnMatrices[idxProblem].cast<double>();
+        std::vector<int> rowIndices(costFcnMatrix.rows()), columnIndices(costFcnMatrix.cols());
+        batchSolver.GetAssignmentResults(idxProblem, rowIndices, columnIndices);
+        if (std::abs(totalCost(costFcnMatrix, rowIndices) - bruteForceCost(costFcnMatrix)) > 1e-3)
+        {
+            testPassed = false;
+            std::cout << "ERROR: Non-optimal assignment for batch problem " << idxProblem << "!\n";
+        }
+        for (int col = 0; col < (int)columnIndices.size(); col++)
+        {
+            if ((columnIndices[col] >= 0) && (rowIndices[columnIndices[col]] != col))
+            {
+                testPassed = false;
+                std::cout << "ERROR: Inconsistent row/col indexing for batch problem " << idxProblem << "!\n";
+            }
+        }
+    }
+    if (testPassed)
+    {
+        std::cout << "Correct assignments for batch problems\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool testWarmStart()
+{
+    bool testPassed = true;
+    std::cout << "[Testing warm start after cost updates]\n";
+
+    std::mt19937 randomGenerator(3);
+    std::uniform_int_distribution<int> costDistribution(0, 1000);
+    int shapes[3][2] = {{40, 40}, {25, 40}, {40, 25}};
+    for (auto &shape : shapes)
+    {
+        Eigen::MatrixXd costFcnMatrix(shape[0], shape[1]);
+        for (int idx = 0; idx < costFcnMatrix.size(); idx++)
+        {
+            costFcnMatrix(idx) = costDistribution(randomGenerator);
+        }
+        auto problem = HungarianAlgorithm<double>(costFcnMatrix, SolverStrategy::ShortestAugmentingPath);
+        problem.SolveAssignmentProblem();
+
+        // Change a few elements, a full row or a full col in each frame and re-solve
+        for (int frame = 0; frame < 30; frame++)
+        {
+            if (frame % 3 == 0)
+            {
+                int row = costDistribution(randomGenerator) % shape[0];
+                for (int col = 0; col < shape[1]; col++)
+                {
+                    costFcnMatrix(row, col) = costDistribution(randomGenerator);
+                }
+            }
+            else if (frame % 3 == 1)
+            {
+                int col = costDistribution(randomGenerator) % shape[1];
+                for (int row = 0; row < shape[0]; row++)
+                {
+                    costFcnMatrix(row, col) = costDistribution(randomGenerator);
+                }
+            }
+            for (int idxChange = 0; idxChange < 5; idxChange++)
+            {
+                costFcnMatrix(costDistribution(randomGenerator) % costFcnMatrix.size()) = costDistribution(randomGenerator);
+            }
+            problem.UpdateCostFunctionMatrix(costFcnMatrix);
+            problem.SolveAssignmentProblem();
+
+            // Compare to a solution from scratch
+            auto checkProblem = HungarianAlgorithm<double>(costFcnMatrix, SolverStrategy::ShortestAugmentingPath);
+            checkProblem.SolveAssignmentProblem();
+            std::vector<int> rowIndices(shape[0]), columnIndices(shape[1]);
+            std::vector<int> checkRowIndices(shape[0]), checkColIndices(shape[1]);
+            problem.GetAssignmentResults(rowIndices, columnIndices);
+            checkProblem.GetAssignmentResults(checkRowIndices, checkColIndices);
+            if (totalCost(costFcnMatrix, rowIndices) != totalCost(costFcnMatrix, checkRowIndices))
+            {
+                testPassed = false;
+                std::cout << "ERROR: Non-optimal assignment after update of " << shape[0] << "x" << shape[1] << " problem!\n";
+            }
+        }
+    }
+    if (testPassed)
+    {
+        std::cout << "Correct assignments after cost updates\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool testSparseMatrix()
+{
+    bool testPassed = true;
+    std::cout << "[Testing sparse matrix]\n";
+
+    // Row 2 has no feasible col left once rows 0 and 1 are assigned
+    Eigen::SparseMatrix<float> costFcnMatrix(3, 3);
+    costFcnMatrix.insert(0, 0) = 4;
+    costFcnMatrix.insert(0, 1) = 1;
+    costFcnMatrix.insert(1, 1) = 2;
+    costFcnMatrix.insert(2, 1) = 3;
+    auto hungAlgProblem = HungarianAlgorithm<float>();
+    hungAlgProblem.SetCostFunctionMatrix(costFcnMatrix);
+    hungAlgProblem.SolveAssignmentProblem();
+    std::vector<int> rowIndices(3), columnIndices(3), infeasibleRows;
+    hungAlgProblem.GetAssignmentResults(rowIndices, columnIndices);
+    hungAlgProblem.GetInfeasibleRows(infeasibleRows);
+    if ((rowIndices != std::vector<int>{0, 1, -1}) || (columnIndices != std::vector<int>{0, 1, -1}) ||
+        (infeasibleRows != std::vector<int>{2}))
+    {
+        testPassed = false;
+        std::cout << "ERROR: Incorrect assignment for sparse 3x3 problem!\n";
+    }
+
+    // Random gated problems: the number of assigned rows is maximized first, then the cost is minimized
+    std::mt19937 randomGenerator(11);
+    std::uniform_int_distribution<int> costDistribution(0, 100);
+    for (int idxProblem = 0; idxProblem < 60; idxProblem++)
+    {
+        int nrRows = 1 + idxProblem % 6;
+        int nrCols = 1 + (idxProblem / 6) % 6;
+        std::vector<Eigen::Triplet<double>> elements;
+        for (int row = 0; row < nrRows; row++)
+        {
+            for (int col = 0; col < nrCols; col++)
+            {
+                if (costDistribution(randomGenerator) < 35)
+                {
+                    elements.push_back(Eigen::Triplet<double>(row, col, costDistribution(randomGenerator)));
+                }
+            }
+        }
+        Eigen::SparseMatrix<double> randomCostFcnMatrix(nrRows, nrCols);
+        randomCostFcnMatrix.setFromTriplets(elements.begin(), elements.end());
+        auto problem = HungarianAlgorithm<double>();
+        problem.SetCostFunctionMatrix(randomCostFcnMatrix);
+        problem.SolveAssignmentProblem();
+        rowIndices.resize(nrRows);
+        columnIndices.resize(nrCols);
+        problem.GetAssignmentResults(rowIndices, columnIndices);
+
+        // Feasible elements get a large negative cost, so the optimal permutation maximizes the number of assigned rows first
+        Eigen::MatrixXd penalizedMatrix = Eigen::MatrixXd::Zero(nrRows, nrCols);
+        for (const auto &element : elements)
+        {
+            penalizedMatrix(element.row(), element.col()) = element.value() - 1e6;
+        }
+        for (int row = 0; row < nrRows; row++)
+        {
+            if ((rowIndices[row] >= 0) && (penalizedMatrix(row, rowIndices[row]) == 0))
+            {
+                testPassed = false;
+                std::cout << "ERROR: Infeasible assignment for sparse " << nrRows << "x" << nrCols << " problem!\n";
+            }
+        }
+        if (totalCost(penalizedMatrix, rowIndices) != bruteForceCost(penalizedMatrix))
+        {
+            testPassed = false;
+            std::cout << "ERROR: Non-optimal assignment for sparse " << nrRows << "x" << nrCols << " problem!\n";
+        }
+    }
+    if (testPassed)
+    {
+        std::cout << "Correct assignments for sparse problems\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool testAuction()
+{
+    bool testPassed = true;
+    std::cout << "[Testing Auction strategy]\n";
+
+    // The same problems solved with the default strategy must yield the same results
+    auto hungAlgProblem = HungarianAlgorithm<float>(SolverStrategy::Auction);
+    testPassed &= test4x4Matrix(hungAlgProblem);
+    testPassed &= test5x4Matrix(hungAlgProblem);
+
+    // Integer costs are solved exactly, compare the total costs to a brute-force search
+    std::mt19937 randomGenerator(7);
+    std::uniform_int_distribution<int> costDistribution(0, 50);
+    for (int idxProblem = 0; idxProblem < 50; idxProblem++)
+    {
+        int nrRows = 1 + idxProblem % 7;
+        int nrCols = 1 + (idxProblem / 7) % 7;
+        Eigen::MatrixXi randomCostFcnMatrix(nrRows, nrCols);
+        for (int idx = 0; idx < randomCostFcnMatrix.size(); idx++)
+        {
+            randomCostFcnMatrix(idx) = costDistribution(randomGenerator);
+        }
+
+        auto problem = HungarianAlgorithm<int>(randomCostFcnMatrix, SolverStrategy::Auction);
+        problem.SolveAssignmentProblem();
+        std::vector<int> rowIndices(nrRows), columnIndices(nrCols);
+        problem.GetAssignmentResults(rowIndices, columnIndices);
+        if (totalCost(randomCostFcnMatrix.cast<double>(), rowIndices) != bruteForceCost(randomCostFcnMatrix.cast<double>()))
+        {
+            testPassed = false;
+            std::cout << "ERROR: Non-optimal assignment for random " << nrRows << "x" << nrCols << " problem!\n";
+        }
+    }
+
+    // Larger problems bid on several threads, the total cost must match the augmenting path solver
+    std::uniform_real_distribution<double> realCostDistribution(0, 100);
+    Eigen::MatrixXd costFcnMatrix(300, 200);
+    for (int idx = 0; idx < costFcnMatrix.size(); idx++)
+    {
+        costFcnMatrix(idx) = realCostDistribution(randomGenerator);
+    }
+    auto referenceProblem = HungarianAlgorithm<double>(costFcnMatrix, SolverStrategy::ShortestAugmentingPath);
+    referenceProblem.SolveAssignmentProblem();
+    std::vector<int> rowIndices(300), columnIndices(200);
+    referenceProblem.GetAssignmentResults(rowIndices, columnIndices);
+    double optimalCost = totalCost(costFcnMatrix, rowIndices);
+    auto problem = HungarianAlgorithm<double>(costFcnMatrix, SolverStrategy::Auction);
+    problem.SetNrOfThreads(4);
+    problem.SolveAssignmentProblem();
+    problem.GetAssignmentResults(rowIndices, columnIndices);
+    if (std::abs(totalCost(costFcnMatrix, rowIndices) - optimalCost) > 1e-6 * optimalCost)
+    {
+        testPassed = false;
+        std::cout << "ERROR: Non-optimal assignment for multi-threaded 300x200 problem!\n";
+    }
+    if (testPassed)
+    {
+        std::cout << "Correct assignments for Auction strategy\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool testFixedSize()
+{
+    bool testPassed = true;
+    std::cout << "[Testing fixed-size problems]\n";
+
+    // Same problem as the 3x3 test
+    Eigen::Matrix3i costFcnMatrix;
+    costFcnMatrix << 40, 60, 15,
+        25, 30, 45,
+        55, 30, 25;
+    auto hungAlgProblem = HungarianAlgorithmFixed<int, 3>(costFcnMatrix);
+    hungAlgProblem.SolveAssignmentProblem();
+    Eigen::Matrix3i assignmentMatrix, expectedMatrix;
+    hungAlgProblem.GetAssignmentMatrix(assignmentMatrix);
+    expectedMatrix << 0, 0, 1,
+        1, 0, 0,
+        0, 1, 0;
+    std::array<int, 3> rowIndices, columnIndices;
+    hungAlgProblem.GetAssignmentResults(rowIndices, columnIndices);
+    if ((assignmentMatrix != expectedMatrix) || (rowIndices != std::array<int, 3>{{2, 0, 1}}) || (columnIndices != std::array<int, 3>{{1, 2, 0}}))
+    {
+        testPassed = false;
+        std::cout << "ERROR: Incorrect assignment for fixed-size 3x3 problem!\n";
+    }
+
+    // Compare the total costs to a brute-force search on random problems of different sizes
+    std::mt19937 randomGenerator(3);
+    testPassed &= testFixedSizeRandom<1>(randomGenerator);
+    testPassed &= testFixedSizeRandom<2>(randomGenerator);
+    testPassed &= testFixedSizeRandom<4>(randomGenerator);
+    testPassed &= testFixedSizeRandom<6>(randomGenerator);
+    testPassed &= testFixedSizeRandom<8>(randomGenerator);
+    if (testPassed)
+    {
+        std::cout << "Correct assignments for fixed-size problems\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+template <int N>
+bool testFixedSizeRandom(std::mt19937 &randomGenerator)
+{
+    bool testPassed = true;
+    std::uniform_real_distribution<float> costDistribution(0, 50);
+    for (int idxProblem = 0; idxProblem < 10; idxProblem++)
+    {
+        Eigen::Matrix<float, N, N> costFcnMatrix;
+        for (int idx = 0; idx < costFcnMatrix.size(); idx++)
+        {
+            costFcnMatrix(idx) = std::round(costDistribution(randomGenerator));
+        }
+        HungarianAlgorithmFixed<float, N> problem(costFcnMatrix);
+        problem.SolveAssignmentProblem();
+        std::array<int, N> rowIndices, columnIndices;
+        problem.GetAssignmentResults(rowIndices, columnIndices);
+        std::vector<int> rowIndicesVector(rowIndices.begin(), rowIndices.end());
+        Eigen::MatrixXd costFcnMatrixDouble = costFcnMatrix.template cast<double>();
+        if (totalCost(costFcnMatrixDouble, rowIndicesVector) != bruteForceCost(costFcnMatrixDouble))
+        {
+            testPassed = false;
+            std::cout << "ERROR: Non-optimal assignment for random fixed-size " << N << "x" << N << " problem!\n";
+        }
+    }
+    return testPassed;
+}
+
+bool testAllocationFree()
+{
+    bool testPassed = true;
+    std::cout << "[Testing allocation-free solving]\n";
+
+    // Problems of varying sizes, the largest one first
+    std::mt19937 randomGenerator(11);
+    std::uniform_real_distribution<double> costDistribution(0, 100);
+    std::vector<Eigen::MatrixXd> costFcnMatrices;
+    for (int nrRows : {40, 3, 17, 25, 8})
+    {
+        for (int nrCols : {40, 5, 17, 31})
+        {
+            costFcnMatrices.push_back(Eigen::MatrixXd(nrRows, nrCols));
+            for (int idx = 0; idx < costFcnMatrices.back().size(); idx++)
+            {
+                costFcnMatrices.back()(idx) = costDistribution(randomGenerator);
+            }
+        }
+    }
+
+    // Solve all problems once to grow the buffers, then count the allocations of solving them again
+    auto hungAlgProblem = HungarianAlgorithm<double>(SolverStrategy::ShortestAugmentingPath);
+    std::vector<int> rowIndices, columnIndices;
+    long nrOfSteadyStateAllocations = 0;
+    for (int idxRepetition = 0; idxRepetition < 6; idxRepetition++)
+    {
+        // Repeat with the Munkres strategy
+        if (idxRepetition == 3)
+        {
+            hungAlgProblem.SetSolverStrategy(SolverStrategy::Munkres);
+        }
+        long nrOfAllocationsBefore = nrOfAllocations;
+        for (const Eigen::MatrixXd &costFcnMatrix : costFcnMatrices)
+        {
+            // Zero-copy view and copied matrix
+            hungAlgProblem.SetCostFunctionView(costFcnMatrix);
+            hungAlgProblem.SolveAssignmentProblem();
+            hungAlgProblem.GetAssignmentResults(rowIndices, columnIndices);
+            hungAlgProblem.SetCostFunctionMatrix(costFcnMatrix);
+            hungAlgProblem.SolveAssignmentProblem();
+            hungAlgProblem.GetAssignmentResults(rowIndices, columnIndices);
+        }
+        if ((idxRepetition != 0) && (idxRepetition != 3))
+        {
+            nrOfSteadyStateAllocations += nrOfAllocations - nrOfAllocationsBefore;
+        }
+    }
+    if (nrOfSteadyStateAllocations != 0)
+    {
+        testPassed = false;
+        std::cout << "ERROR: " << nrOfSteadyStateAllocations << " allocations while solving with reused buffers!\n";
+    }
+
+    // A view with strides (transposed row-major data) gives the same results as the matrix
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> rowMajorMatrix = costFcnMatrices[6];
+    hungAlgProblem.SetCostFunctionView(rowMajorMatrix.data(), (int)rowMajorMatrix.rows(), (int)rowMajorMatrix.cols(), rowMajorMatrix.cols(), 1);
+    hungAlgProblem.SolveAssignmentProblem();
+    hungAlgProblem.GetAssignmentResults(rowIndices, columnIndices);
+    double viewCost = totalCost(costFcnMatrices[6], rowIndices);
+    hungAlgProblem.SetCostFunctionMatrix(costFcnMatrices[6]);
+    hungAlgProblem.SolveAssignmentProblem();
+    hungAlgProblem.GetAssignmentResults(rowIndices, columnIndices);
+    if (std::abs(viewCost - totalCost(costFcnMatrices[6], rowIndices)) > 1e-9)
+    {
+        testPassed = false;
+        std::cout << "ERROR: Incorrect assignment for strided cost function view!\n";
+    }
+    if (testPassed)
+    {
+        std::cout << "No allocations while solving with reused buffers\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool testSolveStatistics()
+{
+    bool testPassed = true;
+    std::cout << "[Testing Solve Statistics]\n";
+
+    std::mt19937 randomGenerator(11);
+    std::uniform_int_distribution<int> costDistribution(0, 50);
+    Eigen::MatrixXi costFcnMatrix(30, 30);
+    for (int idx = 0; idx < costFcnMatrix.size(); idx++)
+    {
+        costFcnMatrix(idx) = costDistribution(randomGenerator);
+    }
+
+    ChromeTraceRecorder recorder;
+    for (SolverStrategy strategy : {SolverStrategy::Munkres, SolverStrategy::ShortestAugmentingPath})
+    {
+        auto hungAlgProblem = HungarianAlgorithm<int>(costFcnMatrix, strategy);
+        hungAlgProblem.SetTraceCallback(recorder.GetCallback());
+        recorder.Clear();
+        const SolveStatistics &statistics = hungAlgProblem.SolveAssignmentProblem();
+        long long nrOfStepCalls = 0;
+        for (int step = 0; step < SolveStep::NrOfSolveSteps; step++)
+        {
+            nrOfStepCalls += statistics.nrOfStepCalls[step];
+        }
+#ifdef HUNGARIAN_ENABLE_STATS
+        // Every row is assigned by an augmenting path (Munkres: rows without a starred zero after the reductions)
+        int minNrOfPaths = (strategy == SolverStrategy::Munkres) ? 1 : (int)costFcnMatrix.rows();
+        if (!statistics.isEnabled || (statistics.nrOfStepCalls[SolveStep::SolveAssignmentProblemStep] != 1) ||
+            (statistics.nrOfIterations != hungAlgProblem.getNrOfIterations()) || (statistics.nrOfAugmentingPaths < minNrOfPaths) ||
+            (statistics.nrOfAugmentingPaths > costFcnMatrix.rows()) || (statistics.maxAugmentingPathLength < 1) ||
+            (statistics.nrOfBytesAllocated <= 0) || (recorder.GetNrOfEvents() != (size_t)nrOfStepCalls))
+        {
+            testPassed = false;
+            std::cout << "ERROR: Incorrect statistics for " << hungAlgProblem.getSolverStrategyName() << " strategy!\n";
+        }
+        // Solving again with grown buffers does not allocate
+        if (hungAlgProblem.SolveAssignmentProblem().nrOfBytesAllocated != 0)
+        {
+            testPassed = false;
+            std::cout << "ERROR: Workspace grew when solving again!\n";
+        }
+        std::ostringstream traceStream;
+        recorder.WriteJson(traceStream);
+        if (traceStream.str().find("\"name\":\"SolveAssignmentProblem\"") == std::string::npos)
+        {
+            testPassed = false;
+            std::cout << "ERROR: Missing solve event in the Chrome trace!\n";
+        }
+#else
+        // Nothing is collected without HUNGARIAN_ENABLE_STATS
+        if (statistics.isEnabled || (nrOfStepCalls != 0) || (recorder.GetNrOfEvents() != 0))
+        {
+            testPassed = false;
+            std::cout << "ERROR: Statistics collected although they are disabled!\n";
+        }
+#endif
+    }
+    if (testPassed)
+    {
+        std::cout << "Statistics and trace events are consistent\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool testDualPotentials()
+{
+    bool testPassed = true;
+    std::cout << "[Testing Dual Potentials]\n";
+
+    std::mt19937 randomGenerator(12);
+    std::uniform_int_distribution<int> costDistribution(0, 20);
+    std::vector<double> rowPotential, colPotential;
+    std::vector<int> rowIndices, columnIndices;
+    for (SolverStrategy strategy : {SolverStrategy::Munkres, SolverStrategy::ShortestAugmentingPath, SolverStrategy::Auction})
+    {
+        // The auction potentials are only optimal within epsilon (1 / (nrCols + 1) for integer costs)
+        double tolerance = (strategy == SolverStrategy::Auction) ? 0.1 : 1e-9;
+        for (int nrRows : {1, 7, 12, 20})
+        {
+            for (int nrCols : {1, 9, 12, 20})
+            {
+                Eigen::MatrixXi costFcnMatrix(nrRows, nrCols);
+                for (int idx = 0; idx < costFcnMatrix.size(); idx++)
+                {
+                    costFcnMatrix(idx) = costDistribution(randomGenerator);
+                }
+                auto hungAlgProblem = HungarianAlgorithm<int>(costFcnMatrix, strategy);
+                hungAlgProblem.SolveAssignmentProblem();
+                hungAlgProblem.GetAssignmentResults(rowIndices, columnIndices);
+                hungAlgProblem.GetDualPotentials(rowPotential, colPotential);
+                double dualCost = std::accumulate(rowPotential.begin(), rowPotential.end(), 0.0) + std::accumulate(colPotential.begin(), colPotential.end(), 0.0);
+                double cost = totalCost(costFcnMatrix.cast<double>(), rowIndices);
+                if (!hungAlgProblem.VerifyOptimality(tolerance) || (hungAlgProblem.GetTotalCost() != cost) ||
+                    (std::abs(dualCost - cost) > tolerance * 20 * std::min(nrRows, nrCols)))
+                {
+                    testPassed = false;
+                    std::cout << "ERROR: Incorrect dual potentials for " << nrRows << "x" << nrCols << " matrix with "
+                              << hungAlgProblem.getSolverStrategyName() << " strategy!\n";
+                }
+            }
+        }
+    }
+
+    // Sparse problems: the potentials only hold for the stored elements, also with more rows than cols and with rows
+    // or cols which cannot be assigned (the last row/col of the smaller dimension of the 10x4 and 4x10 matrices)
+    std::uniform_real_distribution<double> realDistribution(0, 10);
+    for (const auto &dimensions : std::vector<std::pair<int, int>>{{6, 8}, {8, 6}, {7, 7}, {10, 4}, {4, 10}})
+    {
+        int emptyRow = (dimensions.first == 4) ? 3 : -1, emptyCol = (dimensions.second == 4) ? 3 : -1;
+        Eigen::SparseMatrix<double> sparseMatrix(dimensions.first, dimensions.second);
+        for (int row = 0; row < dimensions.first; row++)
+        {
+            for (int col = row % 2; col < dimensions.second; col += 3)
+            {
+                if ((row != emptyRow) && (col != emptyCol))
+                {
+                    sparseMatrix.insert(row, col) = realDistribution(randomGenerator);
+                }
+            }
+        }
+        for (bool isFullyStored : {false, true})
+        {
+            if (isFullyStored)
+            {
+                sparseMatrix = Eigen::MatrixXd::NullaryExpr(dimensions.first, dimensions.second, [&]() { return realDistribution(randomGenerator); }).sparseView();
+            }
+            auto sparseProblem = HungarianAlgorithm<double>();
+            sparseProblem.SetCostFunctionMatrix(sparseMatrix);
+            sparseProblem.SolveAssignmentProblem();
+            sparseProblem.GetDualPotentials(rowPotential, colPotential);
+            double dualCost = std::accumulate(rowPotential.begin(), rowPotential.end(), 0.0) + std::accumulate(colPotential.begin(), colPotential.end(), 0.0);
+            sparseProblem.GetAssignmentResults(rowIndices, columnIndices);
+            bool isEmptyLineAssigned = ((emptyRow != -1) && (rowIndices[emptyRow] != -1)) || ((emptyCol != -1) && (columnIndices[emptyCol] != -1));
+            if (!sparseProblem.VerifyOptimality() || (std::abs(dualCost - sparseProblem.GetTotalCost()) > 1e-9) || (!isFullyStored && isEmptyLineAssigned))
+            {
+                testPassed = false;
+                std::cout << "ERROR: Incorrect dual potentials for " << dimensions.first << "x" << dimensions.second << " sparse matrix!\n";
+            }
+            // Fully stored problems have the same optimum as the dense problem
+            if (isFullyStored)
+            {
+                auto denseProblem = HungarianAlgorithm<double>(Eigen::MatrixXd(sparseMatrix), SolverStrategy::ShortestAugmentingPath);
+                denseProblem.SolveAssignmentProblem();
+                if (std::abs(denseProblem.GetTotalCost() - sparseProblem.GetTotalCost()) > 1e-9)
+                {
+                    testPassed = false;
+                    std::cout << "ERROR: Incorrect total cost for " << dimensions.first << "x" << dimensions.second << " sparse matrix!\n";
+                }
+            }
+        }
+    }
+    if (testPassed)
+    {
+        std::cout << "Dual potentials certify the optimal assignments\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool testBatchFile()
+{
+    bool testPassed = true;
+    std::cout << "[Testing Batch File]\n";
+
+    // Write problems of mixed sizes
+    const std::string path = "HungarianBatchFileTest.hbt";
+    std::mt19937 randomGenerator(13);
+    std::uniform_real_distribution<double> costDistribution(0, 100);
+    std::vector<Eigen::MatrixXd> costFcnMatrices;
+    {
+        BatchFileWriter<double> writer(path);
+        for (int nrRows : {4, 7, 0, 3})
+        {
+            costFcnMatrices.push_back(Eigen::MatrixXd(nrRows, 5));
+            for (int idx = 0; idx < costFcnMatrices.back().size(); idx++)
+            {
+                costFcnMatrices.back()(idx) = costDistribution(randomGenerator);
+            }
+            writer.AddCostFunctionMatrix(costFcnMatrices.back());
+        }
+        writer.Close();
+    }
+
+    // Solve the mapped row-major costs in place and compare to the original matrices
+    {
+        BatchFileReader reader(path);
+        auto hungAlgProblem = HungarianAlgorithm<double>(SolverStrategy::ShortestAugmentingPath);
+        std::vector<int> rowIndices, columnIndices;
+        if ((reader.GetValueType() != BatchValueType::BatchFloat64) || (reader.GetNrOfProblems() != (int)costFcnMatrices.size()))
+        {
+            testPassed = false;
+            std::cout << "ERROR: Incorrect batch file header!\n";
+        }
+        for (int problemIdx = 0; testPassed && (problemIdx < reader.GetNrOfProblems()); problemIdx++)
+        {
+            const Eigen::MatrixXd &costFcnMatrix = costFcnMatrices[problemIdx];
+            int nrRows = reader.GetNrRows(problemIdx), nrCols = reader.GetNrCols(problemIdx);
+            Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> mappedMatrix(reader.GetCosts<double>(problemIdx), nrRows, nrCols);
+            if ((nrRows != costFcnMatrix.rows()) || (nrCols != costFcnMatrix.cols()) || (mappedMatrix != costFcnMatrix))
+            {
+                testPassed = false;
+                std::cout << "ERROR: Incorrect costs of problem " << problemIdx << " in the batch file!\n";
+                break;
+            }
+            hungAlgProblem.SetCostFunctionView(reader.GetCosts<double>(problemIdx), nrRows, nrCols, nrCols, 1);
+            hungAlgProblem.SolveAssignmentProblem();
+            hungAlgProblem.GetAssignmentResults(rowIndices, columnIndices);
+            if ((nrRows > 0) && (std::abs(totalCost(costFcnMatrix, rowIndices) - bruteForceCost(costFcnMatrix)) > 1e-9))
+            {
+                testPassed = false;
+                std::cout << "ERROR: Incorrect assignment of problem " << problemIdx << " in the batch file!\n";
+            }
+        }
+        try
+        {
+            reader.GetCosts<float>(0);
+            testPassed = false;
+            std::cout << "ERROR: Batch file costs read with the wrong type!\n";
+        }
+        catch (const std::invalid_argument &)
+        {
+        }
+    }
+
+    // A file without the header is rejected
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << "This is not a batch file of cost function matrices";
+    }
+    try
+    {
+        BatchFileReader reader(path);
+        testPassed = false;
+        std::cout << "ERROR: Invalid batch file accepted!\n";
+    }
+    catch (const std::invalid_argument &)
+    {
+    }
+    std::remove(path.c_str());
+    if (testPassed)
+    {
+        std::cout << "Batch file problems solved in place\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool testCostFunction()
+{
+    bool testPassed = true;
+    std::cout << "[Testing Cost Function]\n";
+
+    std::mt19937 randomGenerator(14);
+    std::uniform_real_distribution<double> costDistribution(0, 100);
+    std::vector<int> rowIndices, columnIndices;
+    for (int nrRows : {30, 45})
+    {
+        Eigen::MatrixXd costFcnMatrix(nrRows, 75 - nrRows);
+        for (int idx = 0; idx < costFcnMatrix.size(); idx++)
+        {
+            costFcnMatrix(idx) = costDistribution(randomGenerator);
+        }
+        auto referenceProblem = HungarianAlgorithm<double>(costFcnMatrix, SolverStrategy::ShortestAugmentingPath);
+        referenceProblem.SolveAssignmentProblem();
+        double optimalCost = referenceProblem.GetTotalCost();
+
+        // Element function with a cache of the full matrix: each cost is computed once
+        long long nrOfEvaluations = 0;
+        auto hungAlgProblem = HungarianAlgorithm<double>();
+        hungAlgProblem.SetCostFunction((int)costFcnMatrix.rows(), (int)costFcnMatrix.cols(), [&](int row, int col) {
+            nrOfEvaluations++;
+            return costFcnMatrix(row, col);
+        });
+        hungAlgProblem.SolveAssignmentProblem();
+        hungAlgProblem.GetAssignmentResults(rowIndices, columnIndices);
+        if ((std::abs(totalCost(costFcnMatrix, rowIndices) - optimalCost) > 1e-9) || (nrOfEvaluations != costFcnMatrix.size()) ||
+            !hungAlgProblem.VerifyOptimality())
+        {
+            testPassed = false;
+            std::cout << "ERROR: Incorrect assignment for " << nrRows << " rows with a cost function!\n";
+        }
+
+        // Cache of 3 rows computed again when needed
+        hungAlgProblem.SetCostFunction(
+            (int)costFcnMatrix.rows(), (int)costFcnMatrix.cols(), [&](int row, int col) { return costFcnMatrix(row, col); }, nullptr,
+            3 * std::max(costFcnMatrix.rows(), costFcnMatrix.cols()) * sizeof(double));
+        hungAlgProblem.SolveAssignmentProblem();
+        if (std::abs(hungAlgProblem.GetTotalCost() - optimalCost) > 1e-9)
+        {
+            testPassed = false;
+            std::cout << "ERROR: Incorrect assignment for " << nrRows << " rows with a small cost cache!\n";
+        }
+    }
+
+    // Row-block function (row-major blocks)
+    Eigen::MatrixXd costFcnMatrix(20, 100);
+    for (int idx = 0; idx < costFcnMatrix.size(); idx++)
+    {
+        costFcnMatrix(idx) = costDistribution(randomGenerator);
+    }
+    auto referenceProblem = HungarianAlgorithm<double>(costFcnMatrix);
+    referenceProblem.SolveAssignmentProblem();
+    auto hungAlgProblem = HungarianAlgorithm<double>();
+    hungAlgProblem.SetCostFunction(20, 100, nullptr, [&](int firstRow, int nrRows, double *costs) {
+        Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>(costs, nrRows, 100) = costFcnMatrix.middleRows(firstRow, nrRows);
+    });
+    hungAlgProblem.SolveAssignmentProblem();
+    if (std::abs(hungAlgProblem.GetTotalCost() - referenceProblem.GetTotalCost()) > 1e-9)
+    {
+        testPassed = false;
+        std::cout << "ERROR: Incorrect assignment with a row-block cost function!\n";
+    }
+
+    // Verifying and copying the costs with a cache of half the matrix computes each row once (row-block function, and
+    // element function of the transposed matrix)
+    for (bool isTransposed : {false, true})
+    {
+        Eigen::MatrixXd viewedCostFcnMatrix = isTransposed ? Eigen::MatrixXd(costFcnMatrix.transpose()) : costFcnMatrix;
+        long long nrOfEvaluatedCosts = 0;
+        if (isTransposed)
+        {
+            hungAlgProblem.SetCostFunction(
+                100, 20,
+                [&](int row, int col) {
+                    nrOfEvaluatedCosts++;
+                    return viewedCostFcnMatrix(row, col);
+                },
+                nullptr, 10 * 100 * sizeof(double));
+        }
+        else
+        {
+            hungAlgProblem.SetCostFunction(
+                20, 100, nullptr,
+                [&](int firstRow, int nrRows, double *costs) {
+                    nrOfEvaluatedCosts += nrRows * 100;
+                    Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>(costs, nrRows, 100) =
+                        viewedCostFcnMatrix.middleRows(firstRow, nrRows);
+                },
+                10 * 100 * sizeof(double));
+        }
+        hungAlgProblem.SolveAssignmentProblem();
+        nrOfEvaluatedCosts = 0;
+        bool isOptimal = hungAlgProblem.VerifyOptimality();
+        long long nrOfVerifiedCosts = nrOfEvaluatedCosts;
+        nrOfEvaluatedCosts = 0;
+        Eigen::MatrixXd copiedCostFcnMatrix;
+        hungAlgProblem.GetCostFunctionMatrix(copiedCostFcnMatrix);
+        if (!isOptimal || (copiedCostFcnMatrix != viewedCostFcnMatrix) || (nrOfVerifiedCosts > viewedCostFcnMatrix.size()) ||
+            (nrOfEvaluatedCosts > viewedCostFcnMatrix.size()))
+        {
+            testPassed = false;
+            std::cout << "ERROR: Costs computed more than once to verify or copy a cost function!\n";
+        }
+    }
+
+    // Negative costs are detected when they are computed
+    hungAlgProblem.SetCostFunction(5, 5, [](int row, int /*col*/) { return (row == 3) ? -1.0 : 1.0; });
+    try
+    {
+        hungAlgProblem.SolveAssignmentProblem();
+        testPassed = false;
+        std::cout << "ERROR: Negative cost of the cost function accepted!\n";
+    }
+    catch (const std::invalid_argument &)
+    {
+    }
+    if (testPassed)
+    {
+        std::cout << "Costs computed on demand give the optimal assignments\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool testKBestAssignments()
+{
+    bool testPassed = true;
+    std::cout << "[Testing K-Best Assignments]\n";
+
+    std::mt19937 randomGenerator(15);
+    std::uniform_int_distribution<int> costDistribution(0, 20);
+    std::vector<int> rowIndices, columnIndices;
+    for (const auto &dimensions : std::vector<std::pair<int, int>>{{4, 4}, {3, 5}, {5, 3}, {6, 6}})
+    {
+        Eigen::MatrixXi costFcnMatrix(dimensions.first, dimensions.second);
+        for (int idx = 0; idx < costFcnMatrix.size(); idx++)
+        {
+            costFcnMatrix(idx) = costDistribution(randomGenerator);
+        }
+
+        // Costs of all assignments by enumeration of the col permutations of the transposed problem if needed
+        Eigen::MatrixXd solverCosts = costFcnMatrix.cast<double>();
+        if (solverCosts.rows() > solverCosts.cols())
+        {
+            solverCosts.transposeInPlace();
+        }
+        std::vector<int> permutation((size_t)solverCosts.cols());
+        std::iota(permutation.begin(), permutation.end(), 0);
+        std::set<std::vector<int>> assignments;
+        do
+        {
+            assignments.insert(std::vector<int>(permutation.begin(), permutation.begin() + solverCosts.rows()));
+        } while (std::next_permutation(permutation.begin(), permutation.end()));
+        std::vector<double> allCosts;
+        for (const auto &assignment : assignments)
+        {
+            allCosts.push_back(totalCost(solverCosts, assignment));
+        }
+        std::sort(allCosts.begin(), allCosts.end());
+
+        // Ask for more assignments than exist, the ranked costs must match the enumeration
+        int k = (int)allCosts.size() + 3;
+        KBestAssignmentSolver<int> intSolver;
+        intSolver.SetCostFunctionMatrix(costFcnMatrix);
+        KBestAssignmentSolver<double> doubleSolver(3);
+        doubleSolver.SetCostFunctionMatrix(costFcnMatrix.cast<double>());
+        if ((intSolver.SolveKBestAssignments(k) != (int)allCosts.size()) || (doubleSolver.SolveKBestAssignments(k) != (int)allCosts.size()))
+        {
+            testPassed = false;
+            std::cout << "ERROR: Incorrect number of assignments for a " << dimensions.first << "x" << dimensions.second << " matrix!\n";
+            continue;
+        }
+        std::set<std::vector<int>> foundAssignments;
+        for (int idx = 0; idx < intSolver.GetNrOfSolutions(); idx++)
+        {
+            intSolver.GetAssignmentResults(idx, rowIndices, columnIndices);
+            foundAssignments.insert(rowIndices);
+            if ((intSolver.GetTotalCost(idx) != allCosts[idx]) || (totalCost(costFcnMatrix.cast<double>(), rowIndices) != allCosts[idx]) ||
+                (doubleSolver.GetTotalCost(idx) != allCosts[idx]))
+            {
+                testPassed = false;
+                std::cout << "ERROR: Incorrect cost of assignment " << idx << " for a " << dimensions.first << "x" << dimensions.second << " matrix!\n";
+                break;
+            }
+        }
+        if (foundAssignments.size() != allCosts.size())
+        {
+            testPassed = false;
+            std::cout << "ERROR: Repeated assignments for a " << dimensions.first << "x" << dimensions.second << " matrix!\n";
+        }
+    }
+
+    // Pruned search on a larger problem, the results do not depend on the number of threads
+    std::uniform_real_distribution<double> realCostDistribution(0, 100);
+    Eigen::MatrixXd costFcnMatrix(40, 50);
+    for (int idx = 0; idx < costFcnMatrix.size(); idx++)
+    {
+        costFcnMatrix(idx) = realCostDistribution(randomGenerator);
+    }
+    KBestAssignmentSolver<double> singleThreadSolver, multiThreadSolver(4);
+    singleThreadSolver.SetCostFunctionMatrix(costFcnMatrix);
+    multiThreadSolver.SetCostFunctionMatrix(costFcnMatrix);
+    singleThreadSolver.SolveKBestAssignments(25);
+    multiThreadSolver.SolveKBestAssignments(25);
+    auto hungAlgProblem = HungarianAlgorithm<double>(costFcnMatrix);
+    hungAlgProblem.SolveAssignmentProblem();
+    std::vector<int> otherRowIndices, otherColumnIndices;
+    for (int idx = 0; idx < 25; idx++)
+    {
+        singleThreadSolver.GetAssignmentResults(idx, rowIndices, columnIndices);
+        multiThreadSolver.GetAssignmentResults(idx, otherRowIndices, otherColumnIndices);
+        if ((rowIndices != otherRowIndices) || (columnIndices != otherColumnIndices) ||
+            ((idx > 0) && (singleThreadSolver.GetTotalCost(idx) < singleThreadSolver.GetTotalCost(idx - 1))))
+        {
+            testPassed = false;
+            std::cout << "ERROR: Incorrect assignment " << idx << " of the multi-threaded search!\n";
+            break;
+        }
+    }
+    if ((std::abs(singleThreadSolver.GetTotalCost(0) - hungAlgProblem.GetTotalCost()) > 1e-9) || (singleThreadSolver.GetNrOfPrunedProblems() == 0))
+    {
+        testPassed = false;
+        std::cout << "ERROR: Incorrect best assignment or no pruned sub-problems!\n";
+    }
+
+    // Integer costs close to the largest int value cannot be mistaken for forbidden elements
+    for (int size = 2; size <= 3; size++)
+    {
+        Eigen::MatrixXi largeCostFcnMatrix = Eigen::MatrixXi::Constant(size, size, (size == 2) ? 2000000000 : 1500000000);
+        largeCostFcnMatrix.diagonal().setZero();
+        KBestAssignmentSolver<int> largeIntSolver;
+        KBestAssignmentSolver<double> largeDoubleSolver;
+        largeIntSolver.SetCostFunctionMatrix(largeCostFcnMatrix);
+        largeDoubleSolver.SetCostFunctionMatrix(largeCostFcnMatrix.cast<double>());
+        int nrOfAssignments = (size == 2) ? 2 : 6;
+        if ((largeIntSolver.SolveKBestAssignments(10) != nrOfAssignments) || (largeDoubleSolver.SolveKBestAssignments(10) != nrOfAssignments))
+        {
+            testPassed = false;
+            std::cout << "ERROR: Incorrect number of assignments for large integer costs!\n";
+            continue;
+        }
+        for (int idx = 0; idx < nrOfAssignments; idx++)
+        {
+            if (largeIntSolver.GetTotalCost(idx) != largeDoubleSolver.GetTotalCost(idx))
+            {
+                testPassed = false;
+                std::cout << "ERROR: Incorrect cost of assignment " << idx << " for large integer costs!\n";
+                break;
+            }
+        }
+    }
+
+    // 64-bit integer costs close to 2^53 are exact, the ranked costs match the enumeration in integer arithmetic
+    typedef Eigen::Matrix<int64_t, Eigen::Dynamic, Eigen::Dynamic> MatrixXi64;
+    MatrixXi64 int64CostFcnMatrix(3, 3);
+    for (int idx = 0; idx < int64CostFcnMatrix.size(); idx++)
+    {
+        int64CostFcnMatrix(idx) = ((int64_t)1 << 51) + idx;
+    }
+    std::vector<int> permutation{0, 1, 2};
+    std::vector<int64_t> int64Costs;
+    do
+    {
+        int64Costs.push_back(int64CostFcnMatrix(0, permutation[0]) + int64CostFcnMatrix(1, permutation[1]) + int64CostFcnMatrix(2, permutation[2]));
+    } while (std::next_permutation(permutation.begin(), permutation.end()));
+    std::sort(int64Costs.begin(), int64Costs.end());
+    KBestAssignmentSolver<int64_t> int64Solver;
+    int64Solver.SetCostFunctionMatrix(int64CostFcnMatrix);
+    if (int64Solver.SolveKBestAssignments(10) != (int)int64Costs.size())
+    {
+        testPassed = false;
+        std::cout << "ERROR: Incorrect number of assignments for 64-bit integer costs!\n";
+    }
+    else
+    {
+        for (int idx = 0; idx < int64Solver.GetNrOfSolutions(); idx++)
+        {
+            if (int64Solver.GetTotalCost(idx) != (double)int64Costs[idx])
+            {
+                testPassed = false;
+                std::cout << "ERROR: Incorrect cost of assignment " << idx << " for 64-bit integer costs!\n";
+                break;
+            }
+        }
+    }
+    try
+    {
+        int64CostFcnMatrix(0, 0) = ((int64_t)1 << 53) + 1;
+        int64Solver.SetCostFunctionMatrix(int64CostFcnMatrix);
+        testPassed = false;
+        std::cout << "ERROR: 64-bit integer costs above 2^53 are not rejected!\n";
+    }
+    catch (const std::invalid_argument &)
+    {
+    }
+
+    // 16-bit unsigned costs give the same ranked assignments as the same costs stored as int
+    std::uniform_int_distribution<int> uint16CostDistribution(0, 65535);
+    Eigen::Matrix<uint16_t, Eigen::Dynamic, Eigen::Dynamic> uint16CostFcnMatrix(4, 5);
+    for (int idx = 0; idx < uint16CostFcnMatrix.size(); idx++)
+    {
+        uint16CostFcnMatrix(idx) = (uint16_t)uint16CostDistribution(randomGenerator);
+    }
+    KBestAssignmentSolver<uint16_t> uint16Solver;
+    KBestAssignmentSolver<int> uint16IntSolver;
+    uint16Solver.SetCostFunctionMatrix(uint16CostFcnMatrix);
+    uint16IntSolver.SetCostFunctionMatrix(uint16CostFcnMatrix.cast<int>());
+    if (uint16Solver.SolveKBestAssignments(20) != uint16IntSolver.SolveKBestAssignments(20))
+    {
+        testPassed = false;
+        std::cout << "ERROR: Incorrect number of assignments for 16-bit unsigned costs!\n";
+    }
+    else
+    {
+        for (int idx = 0; idx < uint16Solver.GetNrOfSolutions(); idx++)
+        {
+            uint16Solver.GetAssignmentResults(idx, rowIndices, columnIndices);
+            uint16IntSolver.GetAssignmentResults(idx, otherRowIndices, otherColumnIndices);
+            if ((uint16Solver.GetTotalCost(idx) != uint16IntSolver.GetTotalCost(idx)) || (rowIndices != otherRowIndices))
+            {
+                testPassed = false;
+                std::cout << "ERROR: Incorrect assignment " << idx << " for 16-bit unsigned costs!\n";
+                break;
+            }
+        }
+    }
+    if (testPassed)
+    {
+        std::cout << "Ranked assignments match the enumeration of all assignments\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool testAssignmentViews()
+{
+    bool testPassed = true;
+    std::cout << "[Testing Assignment Views]\n";
+
+    std::mt19937 randomGenerator(16);
+    std::uniform_int_distribution<int> costDistribution(0, 50);
+    std::vector<int> rowIndices, columnIndices;
+    Eigen::MatrixXi assignmentMatrix;
+    Eigen::SparseMatrix<int> sparseAssignmentMatrix;
+    for (int nrRows : {5, 8})
+    {
+        Eigen::MatrixXi costFcnMatrix(nrRows, 13 - nrRows);
+        for (int idx = 0; idx < costFcnMatrix.size(); idx++)
+        {
+            costFcnMatrix(idx) = costDistribution(randomGenerator);
+        }
+        for (int idxStrategy = 0; idxStrategy < 4; idxStrategy++)
+        {
+            // The last problem is sparse with the elements of the dense matrix
+            auto hungAlgProblem = HungarianAlgorithm<int>(costFcnMatrix, (idxStrategy < 3) ? (SolverStrategy)idxStrategy : SolverStrategy::Munkres);
+            if (idxStrategy == 3)
+            {
+                hungAlgProblem.SetCostFunctionMatrix(Eigen::SparseMatrix<int>(costFcnMatrix.sparseView()));
+            }
+            hungAlgProblem.SolveAssignmentProblem();
+            hungAlgProblem.GetAssignmentResults(rowIndices, columnIndices);
+            hungAlgProblem.GetAssignmentMatrix(assignmentMatrix);
+            hungAlgProblem.GetAssignmentMatrix(sparseAssignmentMatrix);
+
+            // The views map the stored assignments, so they point to the same memory on every call
+            Eigen::Map<const Eigen::VectorXi> rowAssignment = hungAlgProblem.GetRowAssignment();
+            Eigen::Map<const Eigen::VectorXi> colAssignment = hungAlgProblem.GetColAssignment();
+            if ((rowAssignment.size() != nrRows) || (colAssignment.size() != 13 - nrRows) ||
+                !std::equal(rowIndices.begin(), rowIndices.end(), rowAssignment.data()) ||
+                !std::equal(columnIndices.begin(), columnIndices.end(), colAssignment.data()) ||
+                (rowAssignment.data() != hungAlgProblem.GetRowAssignment().data()) || !assignmentMatrix.isApprox(Eigen::MatrixXi(sparseAssignmentMatrix)) ||
+                (sparseAssignmentMatrix.nonZeros() != std::min(nrRows, 13 - nrRows)))
+            {
+                testPassed = false;
+                std::cout << "ERROR: Incorrect assignment views for " << nrRows << " rows and strategy " << idxStrategy << "!\n";
+            }
+        }
+    }
+    if (testPassed)
+    {
+        std::cout << "Views on the assignments match the copied assignment results\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool testParallelSolve()
+{
+    bool testPassed = true;
+    std::cout << "[Testing Parallel Solve]\n";
+
+    // Problems large enough to be split on the threads, with many equal costs to exercise the tie rules
+    std::mt19937 randomGenerator(17);
+    std::uniform_int_distribution<int> costDistribution(0, 30);
+    std::vector<int> rowIndices, columnIndices, parallelRowIndices, parallelColumnIndices;
+    std::vector<double> rowPotential, colPotential, parallelRowPotential, parallelColPotential;
+    for (const auto &dimensions : std::vector<std::pair<int, int>>{{300, 300}, {2200, 2500}, {2500, 2200}})
+    {
+        Eigen::MatrixXi costFcnMatrix(dimensions.first, dimensions.second);
+        for (int idx = 0; idx < costFcnMatrix.size(); idx++)
+        {
+            costFcnMatrix(idx) = costDistribution(randomGenerator);
+        }
+        SolverStrategy strategy = (dimensions.first < 1000) ? SolverStrategy::Munkres : SolverStrategy::ShortestAugmentingPath;
+        auto hungAlgProblem = HungarianAlgorithm<int>(costFcnMatrix, strategy);
+        hungAlgProblem.SolveAssignmentProblem();
+        hungAlgProblem.GetAssignmentResults(rowIndices, columnIndices);
+        hungAlgProblem.GetDualPotentials(rowPotential, colPotential);
+        auto parallelProblem = HungarianAlgorithm<int>(costFcnMatrix, strategy);
+        parallelProblem.SetNrOfThreads(4);
+        parallelProblem.SolveAssignmentProblem();
+        parallelProblem.GetAssignmentResults(parallelRowIndices, parallelColumnIndices);
+        parallelProblem.GetDualPotentials(parallelRowPotential, parallelColPotential);
+
+        // The results must be identical, not only optimal
+        if ((rowIndices != parallelRowIndices) || (columnIndices != parallelColumnIndices) || (rowPotential != parallelRowPotential) ||
+            (colPotential != parallelColPotential) || (hungAlgProblem.getNrOfIterations() != parallelProblem.getNrOfIterations()) ||
+            !parallelProblem.VerifyOptimality())
+        {
+            testPassed = false;
+            std::cout << "ERROR: Different results of the parallel " << parallelProblem.getSolverStrategyName() << " solve for a " << dimensions.first
+                      << "x" << dimensions.second << " matrix!\n";
+        }
+    }
+    if (testPassed)
+    {
+        std::cout << "Multi-threaded solves give the same results as a single thread\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool testSolverService()
+{
+    bool testPassed = true;
+    std::cout << "[Testing Solver Service]\n";
+
+    // Futures of many problems solved on 3 workers with a small queue
+    std::mt19937 randomGenerator(18);
+    std::uniform_real_distribution<double> costDistribution(0, 100);
+    std::vector<Eigen::MatrixXd> costFcnMatrices;
+    std::vector<std::future<AssignmentResult>> futures;
+    std::atomic<int> nrCallbacks(0);
+    {
+        HungarianSolverService<double> service(3, 4);
+        for (int idx = 0; idx < 20; idx++)
+        {
+            Eigen::MatrixXd costFcnMatrix(10 + idx % 7, 12);
+            for (int idxCost = 0; idxCost < costFcnMatrix.size(); idxCost++)
+            {
+                costFcnMatrix(idxCost) = costDistribution(randomGenerator);
+            }
+            costFcnMatrices.push_back(costFcnMatrix);
+            futures.push_back(service.Submit(costFcnMatrix));
+            size_t nrRows = (size_t)costFcnMatrix.rows();
+            service.Submit(costFcnMatrix, [&nrCallbacks, nrRows](const AssignmentResult &result, std::exception_ptr error) {
+                if (!error && (result.rowIndices.size() == nrRows))
+                {
+                    nrCallbacks++;
+                }
+            });
+        }
+        for (int idx = 0; idx < 20; idx++)
+        {
+            AssignmentResult result = futures[idx].get();
+            auto hungAlgProblem = HungarianAlgorithm<double>(costFcnMatrices[idx]);
+            hungAlgProblem.SolveAssignmentProblem();
+            if ((std::abs(result.totalCost - hungAlgProblem.GetTotalCost()) > 1e-9) ||
+                (std::abs(totalCost(costFcnMatrices[idx], result.rowIndices) - result.totalCost) > 1e-9))
+            {
+                testPassed = false;
+                std::cout << "ERROR: Incorrect assignment of problem " << idx << " solved by the service!\n";
+            }
+        }
+
+        // Failures are reported through the future
+        Eigen::MatrixXd negativeCostFcnMatrix = -Eigen::MatrixXd::Ones(3, 3);
+        std::future<AssignmentResult> failedFuture = service.Submit(negativeCostFcnMatrix);
+        try
+        {
+            failedFuture.get();
+            testPassed = false;
+            std::cout << "ERROR: Negative costs accepted by the service!\n";
+        }
+        catch (const std::invalid_argument &)
+        {
+        }
+        service.WaitUntilIdle();
+        SolverServiceMetrics metrics = service.GetMetrics();
+        if ((nrCallbacks != 20) || (metrics.nrSubmitted != 41) || (metrics.nrCompleted != 41) || (metrics.nrFailed != 1) || (metrics.queueDepth != 0) ||
+            (metrics.maxQueueDepth > 4) || (metrics.nrActive != 0) || (metrics.maxLatencyMs < metrics.meanLatencyMs))
+        {
+            testPassed = false;
+            std::cout << "ERROR: Incorrect callbacks or metrics of the service!\n";
+        }
+    }
+
+    // Back-pressure: a single blocked worker with a queue of one problem rejects the third problem
+    {
+        HungarianSolverService<int> service(1, 1);
+        std::promise<void> workerStarted, releaseWorker;
+        std::shared_future<void> release = releaseWorker.get_future().share();
+        service.Submit(Eigen::MatrixXi::Ones(2, 2), [&](const AssignmentResult &, std::exception_ptr) {
+            workerStarted.set_value();
+            release.wait();
+        });
+        workerStarted.get_future().wait();
+        std::future<AssignmentResult> queuedFuture, rejectedFuture;
+        bool isQueued = service.TrySubmit(Eigen::MatrixXi::Ones(2, 2), queuedFuture);
+        bool isRejected = !service.TrySubmit(Eigen::MatrixXi::Ones(2, 2), rejectedFuture);
+        releaseWorker.set_value();
+        if (!isQueued || !isRejected || (queuedFuture.get().totalCost != 2) || (service.GetMetrics().nrRejected != 1))
+        {
+            testPassed = false;
+            std::cout << "ERROR: Incorrect back-pressure of the service!\n";
+        }
+    }
+    if (testPassed)
+    {
+        std::cout << "Asynchronous solves give the optimal assignments with bounded queues\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool testCostTypes()
+{
+    bool testPassed = true;
+    std::cout << "[Testing Cost Types]\n";
+
+    // The same small costs as int16, uint16, int64 and double must give the same optimal total cost
+    std::mt19937 randomGenerator(19);
+    std::uniform_int_distribution<int> costDistribution(0, 1000);
+    Eigen::MatrixXi costFcnMatrix(30, 40);
+    for (int idx = 0; idx < costFcnMatrix.size(); idx++)
+    {
+        costFcnMatrix(idx) = costDistribution(randomGenerator);
+    }
+    auto referenceProblem = HungarianAlgorithm<double>(costFcnMatrix.cast<double>());
+    referenceProblem.SolveAssignmentProblem();
+    double referenceCost = referenceProblem.GetTotalCost();
+    std::vector<int> rowIndices, columnIndices;
+    for (int strategy = SolverStrategy::Munkres; strategy <= SolverStrategy::Auction; strategy++)
+    {
+        auto int16Problem = HungarianAlgorithm<int16_t>(costFcnMatrix.cast<int16_t>(), (SolverStrategy)strategy);
+        int16Problem.SolveAssignmentProblem();
+        auto uint16Problem = HungarianAlgorithm<uint16_t>(costFcnMatrix.cast<uint16_t>(), (SolverStrategy)strategy);
+        uint16Problem.SolveAssignmentProblem();
+        // Costs close to 2^53 are exact for the Munkres and shortest augmenting path strategies
+        int64_t costOffset = (strategy == SolverStrategy::Auction) ? 0 : ((int64_t)1 << 52);
+        auto int64Problem = HungarianAlgorithm<int64_t>(costFcnMatrix.cast<int64_t>().array() + costOffset, (SolverStrategy)strategy);
+        int64Problem.SolveAssignmentProblem();
+        int64Problem.GetAssignmentResults(rowIndices, columnIndices);
+        int64_t int64Cost = 0;
+        for (int row = 0; row < costFcnMatrix.rows(); row++)
+        {
+            int64Cost += costFcnMatrix(row, rowIndices[row]);
+        }
+        // The auction potentials are only optimal within epsilon
+        bool isVerified = (strategy == SolverStrategy::Auction) || (int16Problem.VerifyOptimality() && uint16Problem.VerifyOptimality());
+        if ((int16Problem.GetTotalCost() != referenceCost) || (uint16Problem.GetTotalCost() != referenceCost) || (int64Cost != referenceCost) ||
+            !isVerified)
+        {
+            testPassed = false;
+            std::cout << "ERROR: Wrong total cost for a narrow or wide cost type with the " << SolverStrategyName[strategy] << " strategy!\n";
+        }
+    }
+
+    // 64-bit integer costs above 2^53 are not exact in the double potentials
+    Eigen::Matrix<int64_t, Eigen::Dynamic, Eigen::Dynamic> largeCostFcnMatrix = costFcnMatrix.cast<int64_t>();
+    largeCostFcnMatrix(3, 5) = ((int64_t)1 << 53) + 1;
+    try
+    {
+        auto int64Problem = HungarianAlgorithm<int64_t>(largeCostFcnMatrix);
+        testPassed = false;
+        std::cout << "ERROR: A 64-bit integer cost above 2^53 was accepted!\n";
+    }
+    catch (const std::invalid_argument &)
+    {
+    }
+    // Integer costs scaled for the auction must be exact as well
+    try
+    {
+        auto int64Problem = HungarianAlgorithm<int64_t>(costFcnMatrix.cast<int64_t>().array() + ((int64_t)1 << 52), SolverStrategy::Auction);
+        int64Problem.SolveAssignmentProblem();
+        testPassed = false;
+        std::cout << "ERROR: An inexact auction on large 64-bit integer costs was accepted!\n";
+    }
+    catch (const std::invalid_argument &)
+    {
+    }
+
+    // The batch solver and the fixed-size solver support the narrow types as well
+    HungarianBatchSolver<uint16_t> batchSolver(2);
+    batchSolver.AddCostFunctionMatrix(costFcnMatrix.cast<uint16_t>());
+    batchSolver.AddCostFunctionMatrix(costFcnMatrix.topLeftCorner(7, 9).cast<uint16_t>());
+    batchSolver.SolveAssignmentProblems();
+    batchSolver.GetAssignmentResults(0, rowIndices, columnIndices);
+    if (totalCost(costFcnMatrix.cast<double>(), rowIndices) != referenceCost)
+    {
+        testPassed = false;
+        std::cout << "ERROR: Wrong total cost of the uint16 batch solver!\n";
+    }
+    // Batch files store the narrow types in their size
+    const std::string path = "HungarianCostTypesTest.hbt";
+    {
+        BatchFileWriter<uint16_t> writer(path);
+        writer.AddCostFunctionMatrix(costFcnMatrix.cast<uint16_t>());
+        writer.Close();
+    }
+    {
+        BatchFileReader reader(path);
+        Eigen::Map<const Eigen::Matrix<uint16_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> mappedMatrix(reader.GetCosts<uint16_t>(0), reader.GetNrRows(0),
+                                                                                                              reader.GetNrCols(0));
+        if ((reader.GetValueType() != BatchValueType::BatchUInt16) || (mappedMatrix != costFcnMatrix.cast<uint16_t>()))
+        {
+            testPassed = false;
+            std::cout << "ERROR: Incorrect costs of a uint16 batch file!\n";
+        }
+    }
+    std::remove(path.c_str());
+    Eigen::Matrix<int16_t, 3, 3> fixedCostFcnMatrix;
+    fixedCostFcnMatrix << 40, 60, 15, 25, 30, 45, 55, 30, 25;
+    auto fixedProblem = HungarianAlgorithmFixed<int16_t, 3>(fixedCostFcnMatrix);
+    fixedProblem.SolveAssignmentProblem();
+    std::array<int, 3> fixedRowIndices, fixedColIndices;
+    fixedProblem.GetAssignmentResults(fixedRowIndices, fixedColIndices);
+    if (fixedRowIndices != std::array<int, 3>{{2, 0, 1}})
+    {
+        testPassed = false;
+        std::cout << "ERROR: Wrong assignment of the int16 fixed-size solver!\n";
+    }
+
+    if (testPassed)
+    {
+        std::cout << "int16, uint16 and int64 costs give the same optimal assignments as double costs\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool testRowMajorInput()
+{
+    bool testPassed = true;
+    std::cout << "[Testing Row-Major Input]\n";
+
+    // Row-major copies, views and strided buffers must give the optimal cost of the column-major matrix
+    std::mt19937 randomGenerator(20);
+    std::uniform_int_distribution<int> costDistribution(0, 50);
+    std::vector<double> rowPotential, colPotential;
+    for (const auto &dimensions : std::vector<std::pair<int, int>>{{40, 40}, {25, 60}, {60, 25}})
+    {
+        Eigen::MatrixXd costFcnMatrix(dimensions.first, dimensions.second);
+        for (int idx = 0; idx < costFcnMatrix.size(); idx++)
+        {
+            costFcnMatrix(idx) = costDistribution(randomGenerator);
+        }
+        Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> rowMajorMatrix = costFcnMatrix;
+        // Row-major buffer with padding at the end of each row
+        std::vector<double> paddedBuffer((size_t)dimensions.first * (dimensions.second + 3), 99);
+        for (int row = 0; row < dimensions.first; row++)
+        {
+            for (int col = 0; col < dimensions.second; col++)
+            {
+                paddedBuffer[(size_t)row * (dimensions.second + 3) + col] = costFcnMatrix(row, col);
+            }
+        }
+        for (int strategy = SolverStrategy::Munkres; strategy <= SolverStrategy::ShortestAugmentingPath; strategy++)
+        {
+            auto referenceProblem = HungarianAlgorithm<double>(costFcnMatrix, (SolverStrategy)strategy);
+            referenceProblem.SolveAssignmentProblem();
+            double referenceCost = referenceProblem.GetTotalCost();
+
+            auto copyProblem = HungarianAlgorithm<double>(rowMajorMatrix, (SolverStrategy)strategy);
+            auto viewProblem = HungarianAlgorithm<double>((SolverStrategy)strategy);
+            viewProblem.SetCostFunctionView(rowMajorMatrix);
+            auto paddedProblem = HungarianAlgorithm<double>((SolverStrategy)strategy);
+            paddedProblem.SetCostFunctionMatrix(paddedBuffer.data(), dimensions.first, dimensions.second, dimensions.second + 3, 1);
+            for (HungarianAlgorithm<double> *problem : {&copyProblem, &viewProblem, &paddedProblem})
+            {
+                problem->SolveAssignmentProblem();
+                problem->GetDualPotentials(rowPotential, colPotential);
+                double dualCost = std::accumulate(rowPotential.begin(), rowPotential.end(), 0.0) + std::accumulate(colPotential.begin(), colPotential.end(), 0.0);
+                if ((problem->GetTotalCost() != referenceCost) || (std::abs(dualCost - referenceCost) > 1e-9) || !problem->VerifyOptimality())
+                {
+                    testPassed = false;
+                    std::cout << "ERROR: Wrong solution of a row-major " << dimensions.first << "x" << dimensions.second << " matrix with the "
+                              << SolverStrategyName[strategy] << " strategy!\n";
+                }
+            }
+
+            // Updates of a row-major copy change the right element
+            copyProblem.UpdateCostFunctionElement(dimensions.first - 1, 2, 7);
+            Eigen::MatrixXd updatedCostFcnMatrix;
+            copyProblem.GetCostFunctionMatrix(updatedCostFcnMatrix);
+            Eigen::MatrixXd expectedCostFcnMatrix = costFcnMatrix;
+            expectedCostFcnMatrix(dimensions.first - 1, 2) = 7;
+            if (updatedCostFcnMatrix != expectedCostFcnMatrix)
+            {
+                testPassed = false;
+                std::cout << "ERROR: Wrong update of a row-major cost function matrix!\n";
+            }
+        }
+    }
+
+    if (testPassed)
+    {
+        std::cout << "Row-major and strided costs are solved in their layout with optimal results\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool testOutOfCore()
+{
+    bool testPassed = true;
+    std::cout << "[Testing Out-Of-Core Solve]\n";
+
+    // Problems read from the file in blocks of rows into a cache of a few rows
+    const std::string path = "HungarianOutOfCoreTest.hbt";
+    std::mt19937 randomGenerator(21);
+    std::uniform_real_distribution<float> costDistribution(0, 100);
+    std::vector<Eigen::MatrixXf> costFcnMatrices;
+    {
+        BatchFileWriter<float> writer(path);
+        for (const auto &dimensions : std::vector<std::pair<int, int>>{{150, 200}, {90, 90}})
+        {
+            costFcnMatrices.push_back(Eigen::MatrixXf(dimensions.first, dimensions.second));
+            for (int idx = 0; idx < costFcnMatrices.back().size(); idx++)
+            {
+                costFcnMatrices.back()(idx) = costDistribution(randomGenerator);
+            }
+            writer.AddCostFunctionMatrix(costFcnMatrices.back());
+        }
+        writer.Close();
+    }
+    {
+        BatchFileReader reader(path);
+        std::vector<int> rowIndices, columnIndices, referenceRowIndices, referenceColumnIndices;
+        for (int problemIdx = 0; problemIdx < reader.GetNrOfProblems(); problemIdx++)
+        {
+            int nrRows = reader.GetNrRows(problemIdx), nrCols = reader.GetNrCols(problemIdx);
+            auto referenceProblem = HungarianAlgorithm<float>(SolverStrategy::ShortestAugmentingPath);
+            referenceProblem.SetCostFunctionView(reader.GetCosts<float>(problemIdx), nrRows, nrCols, nrCols, 1);
+            referenceProblem.SolveAssignmentProblem();
+            referenceProblem.GetAssignmentResults(referenceRowIndices, referenceColumnIndices);
+
+            // The verification reads each row of the file once
+            auto hungAlgProblem = HungarianAlgorithm<float>();
+            CostRowBlockFunction<float> readRows = reader.GetRowBlockFunction<float>(problemIdx);
+            long long nrOfReadRows = 0;
+            hungAlgProblem.SetCostFunction(
+                nrRows, nrCols, nullptr,
+                [&](int firstRow, int nrBlockRows, float *costs) {
+                    nrOfReadRows += nrBlockRows;
+                    readRows(firstRow, nrBlockRows, costs);
+                },
+                10 * nrCols * sizeof(float));
+            hungAlgProblem.SolveAssignmentProblem();
+            hungAlgProblem.GetAssignmentResults(rowIndices, columnIndices);
+            double cost = hungAlgProblem.GetTotalCost();
+            nrOfReadRows = 0;
+            bool isOptimal = hungAlgProblem.VerifyOptimality();
+            if ((rowIndices != referenceRowIndices) || (columnIndices != referenceColumnIndices) || (cost != referenceProblem.GetTotalCost()) ||
+                !isOptimal || (nrOfReadRows > nrRows))
+            {
+                testPassed = false;
+                std::cout << "ERROR: Wrong out-of-core solution of problem " << problemIdx << "!\n";
+            }
+        }
+        // The rows must exist
+        std::vector<float> costs((size_t)10 * reader.GetNrCols(1));
+        try
+        {
+            reader.ReadRows(1, reader.GetNrRows(1) - 5, 10, costs.data());
+            testPassed = false;
+            std::cout << "ERROR: Rows out of range read from the batch file!\n";
+        }
+        catch (const std::invalid_argument &)
+        {
+        }
+    }
+    std::remove(path.c_str());
+
+    if (testPassed)
+    {
+        std::cout << "Problems read in row blocks give the same solution as the mapped costs\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool testSparseDecomposition()
+{
+    bool testPassed = true;
+    std::cout << "[Testing Sparse Decomposition]\n";
+
+    // Gated clusters of rows/cols (shuffled indices), forced pairs, single rows/cols and empty rows/cols
+    std::mt19937 randomGenerator(22);
+    std::uniform_real_distribution<double> costDistribution(1, 100);
+    const int nrRows = 400, nrCols = 450;
+    std::vector<int> rowOrder(nrRows), colOrder(nrCols);
+    std::iota(rowOrder.begin(), rowOrder.end(), 0);
+    std::iota(colOrder.begin(), colOrder.end(), 0);
+    std::shuffle(rowOrder.begin(), rowOrder.end(), randomGenerator);
+    std::shuffle(colOrder.begin(), colOrder.end(), randomGenerator);
+    std::vector<Eigen::Triplet<double>> elements;
+    int firstRow = 0, firstCol = 0, nrClusters = 0;
+    while ((firstRow < nrRows - 12) && (firstCol < nrCols - 14))
+    {
+        // Cluster sizes from 1x1 (forced pairs) to 12x14, each element present with probability 1/2
+        int nrClusterRows = 1 + (int)(randomGenerator() % 12), nrClusterCols = 1 + (int)(randomGenerator() % 14);
+        for (int row = 0; row < nrClusterRows; row++)
+        {
+            // The first col of the cluster connects all its rows
+            elements.push_back(Eigen::Triplet<double>(rowOrder[firstRow + row], colOrder[firstCol], costDistribution(randomGenerator)));
+            for (int col = 1; col < nrClusterCols; col++)
+            {
+                if (randomGenerator() % 2 == 0)
+                {
+                    elements.push_back(Eigen::Triplet<double>(rowOrder[firstRow + row], colOrder[firstCol + col], costDistribution(randomGenerator)));
+                }
+            }
+        }
+        firstRow += nrClusterRows;
+        firstCol += nrClusterCols;
+        nrClusters++;
+    }
+    Eigen::SparseMatrix<double> costFcnMatrix(nrRows, nrCols);
+    costFcnMatrix.setFromTriplets(elements.begin(), elements.end());
+
+    auto referenceProblem = HungarianAlgorithm<double>();
+    referenceProblem.SetSparseDecomposition(false);
+    referenceProblem.SetCostFunctionMatrix(costFcnMatrix);
+    referenceProblem.SolveAssignmentProblem();
+    std::vector<int> referenceInfeasibleRows, infeasibleRows, rowIndices, columnIndices, parallelRowIndices, parallelColumnIndices;
+    referenceProblem.GetInfeasibleRows(referenceInfeasibleRows);
+
+    auto hungAlgProblem = HungarianAlgorithm<double>();
+    hungAlgProblem.SetNrOfThreads(2);
+    hungAlgProblem.SetCostFunctionMatrix(costFcnMatrix);
+    hungAlgProblem.SolveAssignmentProblem();
+    hungAlgProblem.GetAssignmentResults(rowIndices, columnIndices);
+    hungAlgProblem.GetInfeasibleRows(infeasibleRows);
+    // The rows/cols outside the clusters and the cols without elements are components of their own
+    int nrComponents = nrClusters + (nrRows - firstRow);
+    for (int col = 0; col < nrCols; col++)
+    {
+        nrComponents += (costFcnMatrix.col(col).nonZeros() == 0);
+    }
+    if ((hungAlgProblem.getNrOfComponents() != nrComponents) || (std::abs(hungAlgProblem.GetTotalCost() - referenceProblem.GetTotalCost()) > 1e-9) ||
+        (infeasibleRows.size() != referenceInfeasibleRows.size()) || !hungAlgProblem.VerifyOptimality())
+    {
+        testPassed = false;
+        std::cout << "ERROR: The decomposed sparse problem differs from the problem solved at once!\n";
+    }
+
+    // The components solved on more threads give the same results
+    auto parallelProblem = HungarianAlgorithm<double>();
+    parallelProblem.SetNrOfThreads(4);
+    parallelProblem.SetCostFunctionMatrix(costFcnMatrix);
+    parallelProblem.SolveAssignmentProblem();
+    parallelProblem.GetAssignmentResults(parallelRowIndices, parallelColumnIndices);
+    if ((parallelRowIndices != rowIndices) || (parallelColumnIndices != columnIndices) || (parallelProblem.getNrOfIterations() != hungAlgProblem.getNrOfIterations()))
+    {
+        testPassed = false;
+        std::cout << "ERROR: Different results of the parallel decomposed sparse problem!\n";
+    }
+
+    if (testPassed)
+    {
+        std::cout << "Sparse problems split into " << nrComponents << " components give the optimal assignments\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool testBudgetedSolve()
+{
+    bool testPassed = true;
+    std::cout << "[Testing Budgeted Solve]\n";
+
+    // Wide and tall problems (the tall one is solved transposed)
+    std::mt19937 randomGenerator(23);
+    std::uniform_real_distribution<double> costDistribution(0, 100);
+    const int sizes[2][2] = {{60, 80}, {80, 60}};
+    int nrInterruptedSolves = 0;
+    for (const auto &size : sizes)
+    {
+        Eigen::MatrixXd costFcnMatrix = Eigen::MatrixXd::NullaryExpr(size[0], size[1], [&]() { return costDistribution(randomGenerator); });
+        auto referenceProblem = HungarianAlgorithm<double>(costFcnMatrix, SolverStrategy::ShortestAugmentingPath);
+        referenceProblem.SolveAssignmentProblem();
+        double optimalCost = referenceProblem.GetTotalCost();
+
+        // Continue the solve with a small iteration budget until it is done
+        auto hungAlgProblem = HungarianAlgorithm<double>(costFcnMatrix, SolverStrategy::ShortestAugmentingPath);
+        SolveBudget budget;
+        budget.maxIterations = 10;
+        std::vector<int> rowIndices, columnIndices;
+        double previousGap = std::numeric_limits<double>::infinity();
+        for (int idxSolve = 0; idxSolve < 1000; idxSolve++)
+        {
+            hungAlgProblem.SolveAssignmentProblem(budget);
+            if (hungAlgProblem.getProblemStatus() == ProblemStatus::Done)
+            {
+                break;
+            }
+            nrInterruptedSolves++;
+            // The best assignment so far is a full assignment within the gap of the optimum
+            hungAlgProblem.GetAssignmentResults(rowIndices, columnIndices);
+            int nrAssigned = 0;
+            for (int row = 0; row < size[0]; row++)
+            {
+                nrAssigned += (rowIndices[row] >= 0) && (columnIndices[rowIndices[row]] == row);
+            }
+            double cost = hungAlgProblem.GetTotalCost();
+            double gap = hungAlgProblem.getOptimalityGap();
+            if ((nrAssigned != std::min(size[0], size[1])) || (hungAlgProblem.getNrOfIterations() > budget.maxIterations) ||
+                (cost < optimalCost - 1e-9) || (cost - gap > optimalCost + 1e-9) || (gap > previousGap + 1e-9))
+            {
+                testPassed = false;
+                std::cout << "ERROR: Invalid assignment or optimality gap of an interrupted solve!\n";
+                break;
+            }
+            previousGap = gap;
+        }
+        if ((hungAlgProblem.getProblemStatus() != ProblemStatus::Done) || (std::abs(hungAlgProblem.GetTotalCost() - optimalCost) > 1e-9) ||
+            (hungAlgProblem.getOptimalityGap() != 0) || !hungAlgProblem.VerifyOptimality())
+        {
+            testPassed = false;
+            std::cout << "ERROR: The continued solve is not optimal!\n";
+        }
+
+        // An exhausted time budget stops before the first augmentation
+        budget = SolveBudget();
+        budget.maxTime = 0;
+        hungAlgProblem.SetCostFunctionMatrix(costFcnMatrix);
+        hungAlgProblem.SolveAssignmentProblem(budget);
+        if ((hungAlgProblem.getProblemStatus() != ProblemStatus::Interrupted) || (hungAlgProblem.GetTotalCost() - hungAlgProblem.getOptimalityGap() > optimalCost + 1e-9))
+        {
+            testPassed = false;
+            std::cout << "ERROR: The time budget of the solve is not respected!\n";
+        }
+        // An unlimited solve finishes the interrupted one
+        hungAlgProblem.SolveAssignmentProblem();
+        if ((hungAlgProblem.getProblemStatus() != ProblemStatus::Done) || (std::abs(hungAlgProblem.GetTotalCost() - optimalCost) > 1e-9))
+        {
+            testPassed = false;
+            std::cout << "ERROR: The interrupted solve is not finished!\n";
+        }
+    }
+
+    // Only the shortest augmenting paths can be interrupted
+    try
+    {
+        Eigen::MatrixXd costFcnMatrix = Eigen::MatrixXd::Ones(3, 3);
+        auto hungAlgProblem = HungarianAlgorithm<double>(costFcnMatrix);
+        SolveBudget budget;
+        budget.maxIterations = 1;
+        hungAlgProblem.SolveAssignmentProblem(budget);
+        testPassed = false;
+        std::cout << "ERROR: The Munkres steps accepted a limited budget!\n";
+    }
+    catch (const std::invalid_argument &)
+    {
+    }
+
+    if (testPassed)
+    {
+        std::cout << nrInterruptedSolves << " interrupted solves give full assignments within their optimality gaps\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool testGeometricAssignment()
+{
+    bool testPassed = true;
+    std::cout << "[Testing Geometric Assignment]\n";
+
+    // Tracks and detections in 2D and 3D, compared to the gated pairs of all n x m distances
+    std::mt19937 randomGenerator(24);
+    std::uniform_real_distribution<double> coordinateDistribution(-50, 50);
+    const double maxDistance = 8;
+    int nrCandidatesTotal = 0;
+    for (int nrDims = 1; nrDims <= 3; nrDims++)
+    {
+        const int nrTracks = 300, nrDetections = 350;
+        Eigen::MatrixXd tracks = Eigen::MatrixXd::NullaryExpr(nrTracks, nrDims, [&]() { return coordinateDistribution(randomGenerator); });
+        Eigen::MatrixXd detections = Eigen::MatrixXd::NullaryExpr(nrDetections, nrDims, [&]() { return coordinateDistribution(randomGenerator); });
+        std::vector<Eigen::Triplet<double>> elements;
+        for (int track = 0; track < nrTracks; track++)
+        {
+            for (int detection = 0; detection < nrDetections; detection++)
+            {
+                double distance = (tracks.row(track) - detections.row(detection)).norm();
+                if (distance <= maxDistance)
+                {
+                    elements.push_back(Eigen::Triplet<double>(track, detection, distance));
+                }
+            }
+        }
+        Eigen::SparseMatrix<double> costFcnMatrix(nrTracks, nrDetections);
+        costFcnMatrix.setFromTriplets(elements.begin(), elements.end());
+        auto referenceProblem = HungarianAlgorithm<double>();
+        referenceProblem.SetCostFunctionMatrix(costFcnMatrix);
+        referenceProblem.SolveAssignmentProblem();
+        std::vector<int> referenceInfeasibleRows, infeasibleRows;
+        referenceProblem.GetInfeasibleRows(referenceInfeasibleRows);
+
+        GeometricCandidates<double> candidates;
+        candidates.Build(tracks, detections, maxDistance);
+        auto hungAlgProblem = HungarianAlgorithm<double>();
+        hungAlgProblem.SetCostFunctionPoints(tracks, detections, maxDistance);
+        hungAlgProblem.SolveAssignmentProblem();
+        hungAlgProblem.GetInfeasibleRows(infeasibleRows);
+        if ((candidates.GetNrOfCandidates() != (int)elements.size()) || (std::abs(hungAlgProblem.GetTotalCost() - referenceProblem.GetTotalCost()) > 1e-9) ||
+            (infeasibleRows != referenceInfeasibleRows) || !hungAlgProblem.VerifyOptimality())
+        {
+            testPassed = false;
+            std::cout << "ERROR: The geometric problem in " << nrDims << "D differs from the gated dense distances!\n";
+        }
+        nrCandidatesTotal += candidates.GetNrOfCandidates();
+    }
+
+    // Integer coordinates give rounded distances
+    Eigen::MatrixXi tracks(2, 2), detections(3, 2);
+    tracks << 0, 0, 10, 10;
+    detections << 1, 1, 10, 13, 50, 50;
+    auto integerProblem = HungarianAlgorithm<int>();
+    integerProblem.SetCostFunctionPoints(tracks, detections, 5);
+    integerProblem.SolveAssignmentProblem();
+    std::vector<int> rowIndices, columnIndices;
+    integerProblem.GetAssignmentResults(rowIndices, columnIndices);
+    if ((rowIndices != std::vector<int>{0, 1}) || (integerProblem.GetTotalCost() != 4))
+    {
+        testPassed = false;
+        std::cout << "ERROR: Wrong assignment of integer points!\n";
+    }
+
+    if (testPassed)
+    {
+        std::cout << nrCandidatesTotal << " gated pairs of 1D/2D/3D point sets give the optimal assignments\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+bool testDynamicLines()
+{
+    bool testPassed = true;
+    std::cout << "[Testing Dynamic Lines]\n";
+
+    // Random births and deaths of rows/cols (column-major and row-major costs), compared to solving from scratch
+    std::mt19937 randomGenerator(25);
+    std::uniform_real_distribution<double> costDistribution(0, 100);
+    long long nrIterations = 0, nrReferenceIterations = 0;
+    for (int isRowMajor = 0; isRowMajor <= 1; isRowMajor++)
+    {
+        Eigen::MatrixXd costFcnMatrix = Eigen::MatrixXd::NullaryExpr(100, 100, [&]() { return costDistribution(randomGenerator); });
+        auto hungAlgProblem = HungarianAlgorithm<double>(SolverStrategy::ShortestAugmentingPath);
+        if (isRowMajor)
+        {
+            hungAlgProblem.SetCostFunctionMatrix(Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>(costFcnMatrix));
+        }
+        else
+        {
+            hungAlgProblem.SetCostFunctionMatrix(costFcnMatrix);
+        }
+        hungAlgProblem.SolveAssignmentProblem();
+        for (int idxChange = 0; idxChange < 60; idxChange++)
+        {
+            // Keep the problem around 100x100, so that it changes between wide, square and tall
+            int change = (int)(randomGenerator() % 4);
+            if ((change == 0) && (costFcnMatrix.rows() < 103))
+            {
+                Eigen::VectorXd rowCosts = Eigen::VectorXd::NullaryExpr(costFcnMatrix.cols(), [&]() { return costDistribution(randomGenerator); });
+                hungAlgProblem.AddRow(rowCosts);
+                costFcnMatrix.conservativeResize(costFcnMatrix.rows() + 1, Eigen::NoChange);
+                costFcnMatrix.row(costFcnMatrix.rows() - 1) = rowCosts.transpose();
+            }
+            else if ((change == 1) && (costFcnMatrix.cols() < 103))
+            {
+                Eigen::VectorXd colCosts = Eigen::VectorXd::NullaryExpr(costFcnMatrix.rows(), [&]() { return costDistribution(randomGenerator); });
+                hungAlgProblem.AddCol(colCosts);
+                costFcnMatrix.conservativeResize(Eigen::NoChange, costFcnMatrix.cols() + 1);
+                costFcnMatrix.col(costFcnMatrix.cols() - 1) = colCosts;
+            }
+            else if ((change == 2) && (costFcnMatrix.rows() > 97))
+            {
+                int row = (int)(randomGenerator() % costFcnMatrix.rows());
+                hungAlgProblem.RemoveRow(row);
+                Eigen::MatrixXd remainingCosts(costFcnMatrix.rows() - 1, costFcnMatrix.cols());
+                remainingCosts << costFcnMatrix.topRows(row), costFcnMatrix.bottomRows(costFcnMatrix.rows() - row - 1);
+                costFcnMatrix = remainingCosts;
+            }
+            else if ((change == 3) && (costFcnMatrix.cols() > 97))
+            {
+                int col = (int)(randomGenerator() % costFcnMatrix.cols());
+                hungAlgProblem.RemoveCol(col);
+                Eigen::MatrixXd remainingCosts(costFcnMatrix.rows(), costFcnMatrix.cols() - 1);
+                remainingCosts << costFcnMatrix.leftCols(col), costFcnMatrix.rightCols(costFcnMatrix.cols() - col - 1);
+                costFcnMatrix = remainingCosts;
+            }
+            // Some changes are solved together
+            if (randomGenerator() % 4 == 0)
+            {
+                continue;
+            }
+            hungAlgProblem.SolveAssignmentProblem();
+            nrIterations += hungAlgProblem.getNrOfIterations();
+
+            auto referenceProblem = HungarianAlgorithm<double>(costFcnMatrix, SolverStrategy::ShortestAugmentingPath);
+            referenceProblem.SolveAssignmentProblem();
+            nrReferenceIterations += referenceProblem.getNrOfIterations();
+            Eigen::MatrixXd outMatrix;
+            hungAlgProblem.GetCostFunctionMatrix(outMatrix);
+            if ((outMatrix != costFcnMatrix) || (std::abs(hungAlgProblem.GetTotalCost() - referenceProblem.GetTotalCost()) > 1e-9) ||
+                !hungAlgProblem.VerifyOptimality())
+            {
+                testPassed = false;
+                std::cout << "ERROR: The solution after changing the rows/cols differs from a new solve!\n";
+                break;
+            }
+        }
+    }
+    // The repairs scan far fewer rows than the new solves
+    if (nrIterations * 2 > nrReferenceIterations)
+    {
+        testPassed = false;
+        std::cout << "ERROR: The changed problems are not solved incrementally!\n";
+    }
+
+    if (testPassed)
+    {
+        std::cout << "Problems with added and removed rows/cols are re-solved optimally with " << nrIterations << " instead of " << nrReferenceIterations
+                  << " scanned rows\n";
+    }
+    std::cout << "----------\n";
+    return testPassed;
+}
+
+double totalCost(const Eigen::MatrixXd &costFcnMatrix, const std::vector<int> &rowIndices)
+{
+    // Sum the costs of the assigned elements
+    double cost = 0;
+    for (int row = 0; row < (int)rowIndices.size(); row++)
+    {
+        if (rowIndices[row] >= 0)
+        {
+            cost += costFcnMatrix(row, rowIndices[row]);
+        }
+    }
+    return cost;
+}
+
+double bruteForceCost(const Eigen::MatrixXd &costFcnMatrix)
+{
+    // Check all permutations of the cols (padded to a square problem) for the optimal cost
+    int nrRows = (int)costFcnMatrix.rows();
+    int nrCols = (int)costFcnMatrix.cols();
+    std::vector<int> permutation(std::max(nrRows, nrCols));
+    for (int idx = 0; idx < (int)permutation.size(); idx++)
+    {
+        permutation[idx] = idx;
+    }
+    double optimalCost = std::numeric_limits<double>::infinity();
+    do
+    {
+        double cost = 0;
+        for (int row = 0; row < nrRows; row++)
+        {
+            if (permutation[row] < nrCols)
+            {
+                cost += costFcnMatrix(row, permutation[row]);
+            }
+        }
+        optimalCost = std::min(optimalCost, cost);
+    } while (std::next_permutation(permutation.begin(), permutation.end()));
+    return optimalCost;
+}
+
+// Count the heap allocations of the program to check allocation-free solving. The replaced functions are not inlined,
+// otherwise the compiler pairs the malloc()/free() inside them with the operators of the caller (-Wmismatched-new-delete)
+#if defined(_MSC_VER)
+#define NOINLINE_ALLOCATION __declspec(noinline)
+#elif defined(__GNUC__)
+#define NOINLINE_ALLOCATION __attribute__((noinline))
+#else
+#define NOINLINE_ALLOCATION
+#endif
+
+NOINLINE_ALLOCATION void *operator new(std::size_t size)
+{
+    nrOfAllocations++;
+    void *ptr = std::malloc(size ? size : 1);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+NOINLINE_ALLOCATION void *operator new[](std::size_t size) { return operator new(size); }
+NOINLINE_ALLOCATION void operator delete(void *ptr) noexcept { std::free(ptr); }
+NOINLINE_ALLOCATION void operator delete[](void *ptr) noexcept { std::free(ptr); }
+NOINLINE_ALLOCATION void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+NOINLINE_ALLOCATION void operator delete[](void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+#if defined(__cpp_aligned_new)
+// Over-aligned types (C++17)
+NOINLINE_ALLOCATION void *operator new(std::size_t size, std::align_val_t alignment)
+{
+    nrOfAllocations++;
+#if defined(_MSC_VER)
+    void *ptr = _aligned_malloc(size ? size : 1, (std::size_t)alignment);
+#else
+    // The size of aligned_alloc must be a multiple of the alignment
+    std::size_t alignedSize = ((size ? size : 1) + (std::size_t)alignment - 1) / (std::size_t)alignment * (std::size_t)alignment;
+    void *ptr = std::aligned_alloc((std::size_t)alignment, alignedSize);
+#endif
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+NOINLINE_ALLOCATION void *operator new[](std::size_t size, std::align_val_t alignment) { return operator new(size, alignment); }
+NOINLINE_ALLOCATION void operator delete(void *ptr, std::align_val_t) noexcept
+{
+#if defined(_MSC_VER)
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+NOINLINE_ALLOCATION void operator delete[](void *ptr, std::align_val_t alignment) noexcept { operator delete(ptr, alignment); }
+NOINLINE_ALLOCATION void operator delete(void *ptr, std::size_t, std::align_val_t alignment) noexcept { operator delete(ptr, alignment); }
+NOINLINE_ALLOCATION void operator delete[](void *ptr, std::size_t, std::align_val_t alignment) noexcept { operator delete(ptr, alignment); }
+#endif
@@ -0,0 +1,249 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#include "AuctionSolver.h"
+
+// Factor by which epsilon is reduced after each auction
+#define EPSILON_REDUCTION_FACTOR 7.0
+// Minimum number of bids to compute them on the thread pool
+#define MIN_PARALLEL_BIDS 64
+
+template <typename T>
+AuctionSolver<T>::AuctionSolver() : nrRows(0), nrCols(0), costScale(1), relativeEpsilon(1e-7), zeroCost(0), nrOfRounds(0) {}
+
+template <typename T>
+void AuctionSolver<T>::SetRelativeEpsilon(double epsilon)
+{
+    if (epsilon <= 0)
+    {
+        throw std::invalid_argument("The auction epsilon must be positive!");
+    }
+    relativeEpsilon = epsilon;
+}
+
+template <typename T>
+void AuctionSolver<T>::Solve(CostMatrixView<T> &costMatrix, ThreadPool *threadPool)
+{
+    nrRows = costMatrix.GetNrRows();
+    nrCols = costMatrix.GetNrCols();
+    if (nrRows > nrCols)
+    {
+        throw std::invalid_argument("The number of rows cannot exceed the number of cols!");
+    }
+
+    // Find the largest cost
+    double maxCost = 0;
+    for (int row = 0; row < nrRows; row++)
+    {
+        Eigen::Index colStride;
+        const T *costRow = costMatrix.GetRow(row, colStride);
+        for (int col = 0; col < nrCols; col++)
+        {
+            maxCost = std::max(maxCost, (double)costRow[col * colStride]);
+        }
+    }
+    // Integer costs: an assignment within nrCols * 1 of the optimum on costs scaled by (nrCols + 1) is optimal
+    double finalEpsilon;
+    if (std::is_integral<T>::value)
+    {
+        costScale = nrCols + 1;
+        finalEpsilon = 1;
+        // The scaled costs and prices must stay exact in double precision (only a limit for 64-bit integer costs)
+        if (costScale * maxCost > (double)((int64_t)1 << 53))
+        {
+            throw std::invalid_argument("The integer costs are too large for an exact auction!");
+        }
+    }
+    else
+    {
+        costScale = 1;
+        finalEpsilon = std::max(relativeEpsilon * maxCost, std::numeric_limits<double>::min());
+    }
+
+    // Reset the prices and the workspace
+    prices.assign(nrCols, 0);
+    auctionRowAssignment.resize(nrCols);
+    auctionColAssignment.resize(nrCols);
+    bidCols.resize(nrCols);
+    bidPrices.resize(nrCols);
+    bestBidPrice.assign(nrCols, -std::numeric_limits<double>::infinity());
+    bestBidRow.resize(nrCols);
+    nrOfRounds = 0;
+
+    // Epsilon-scaling: each auction starts from the prices of the previous one
+    double epsilon = std::max(costScale * maxCost / 5, finalEpsilon);
+    while (true)
+    {
+        RunAuction(costMatrix, epsilon, threadPool);
+        if (epsilon <= finalEpsilon)
+        {
+            break;
+        }
+        epsilon = std::max(epsilon / EPSILON_REDUCTION_FACTOR, finalEpsilon);
+    }
+
+    // Report the assignments of the real rows
+    rowAssignment.assign(auctionRowAssignment.begin(), auctionRowAssignment.begin() + nrRows);
+    colAssignment.resize(nrCols);
+    for (int col = 0; col < nrCols; col++)
+    {
+        colAssignment[col] = (auctionColAssignment[col] < nrRows) ? auctionColAssignment[col] : -1;
+    }
+}
+
+template <typename T>
+void AuctionSolver<T>::GetColPrices(std::vector<double> &colPrices) const
+{
+    colPrices.resize(nrCols);
+    for (int col = 0; col < nrCols; col++)
+    {
+        colPrices[col] = prices[col] / costScale;
+    }
+}
+
+template <typename T>
+void AuctionSolver<T>::RunAuction(CostMatrixView<T> &costMatrix, double epsilon, ThreadPool *threadPool)
+{
+    // All rows (including dummy rows) start unassigned
+    std::fill(auctionRowAssignment.begin(), auctionRowAssignment.end(), -1);
+    std::fill(auctionColAssignment.begin(), auctionColAssignment.end(), -1);
+    biddingRows.resize(nrCols);
+    for (int row = 0; row < nrCols; row++)
+    {
+        biddingRows[row] = row;
+    }
+
+    while (!biddingRows.empty())
+    {
+        nrOfRounds++;
+        // Bidding phase: the bids only depend on the prices of the previous round (Jacobi)
+        int nrBids = (int)biddingRows.size();
+        if ((threadPool != nullptr) && (nrBids >= MIN_PARALLEL_BIDS))
+        {
+            int nrChunks = std::min(nrBids, 4 * threadPool->GetNrThreads());
+            threadPool->ParallelFor(nrChunks, [&](int idxChunk, int) {
+                for (int idxBid = (int)((long long)nrBids * idxChunk / nrChunks); idxBid < (int)((long long)nrBids * (idxChunk + 1) / nrChunks); idxBid++)
+                {
+                    ComputeBid(costMatrix, idxBid, epsilon);
+                }
+            });
+        }
+        else
+        {
+            for (int idxBid = 0; idxBid < nrBids; idxBid++)
+            {
+                ComputeBid(costMatrix, idxBid, epsilon);
+            }
+        }
+
+        // Assignment phase: each col goes to its highest bidder (the first one for equal bids)
+        biddenCols.clear();
+        for (int idxBid = 0; idxBid < nrBids; idxBid++)
+        {
+            int col = bidCols[idxBid];
+            if (bestBidPrice[col] == -std::numeric_limits<double>::infinity())
+            {
+                biddenCols.push_back(col);
+            }
+            if (bidPrices[idxBid] > bestBidPrice[col])
+            {
+                bestBidPrice[col] = bidPrices[idxBid];
+                bestBidRow[col] = biddingRows[idxBid];
+            }
+        }
+        nextBiddingRows.clear();
+        for (int idxBid = 0; idxBid < nrBids; idxBid++)
+        {
+            // Rows which lost their bid stay unassigned
+            if (bestBidRow[bidCols[idxBid]] != biddingRows[idxBid])
+            {
+                nextBiddingRows.push_back(biddingRows[idxBid]);
+            }
+        }
+        for (int col : biddenCols)
+        {
+            // The previous owner of the col becomes unassigned
+            int previousRow = auctionColAssignment[col];
+            if (previousRow != -1)
+            {
+                auctionRowAssignment[previousRow] = -1;
+                nextBiddingRows.push_back(previousRow);
+            }
+            auctionColAssignment[col] = bestBidRow[col];
+            auctionRowAssignment[bestBidRow[col]] = col;
+            prices[col] = bestBidPrice[col];
+            bestBidPrice[col] = -std::numeric_limits<double>::infinity();
+        }
+        biddingRows.swap(nextBiddingRows);
+    }
+}
+
+template <typename T>
+void AuctionSolver<T>::ComputeBid(CostMatrixView<T> &costMatrix, int idxBid, double epsilon)
+{
+    int row = biddingRows[idxBid];
+    // Dummy rows have zero costs for all cols
+    Eigen::Index colStride = 0;
+    const T *costRow = (row < nrRows) ? costMatrix.GetRow(row, colStride) : &zeroCost;
+
+    // Find the best and second best value (-cost - price) of the row
+    double bestValue = -std::numeric_limits<double>::infinity();
+    double secondValue = -std::numeric_limits<double>::infinity();
+    int bestCol = 0;
+    for (int col = 0; col < nrCols; col++)
+    {
+        double value = -costScale * (double)costRow[col * colStride] - prices[col];
+        if (value > bestValue)
+        {
+            secondValue = bestValue;
+            bestValue = value;
+            bestCol = col;
+        }
+        else if (value > secondValue)
+        {
+            secondValue = value;
+        }
+    }
+    // Raise the price such that the col stays the best choice within epsilon
+    bidCols[idxBid] = bestCol;
+    bidPrices[idxBid] = prices[bestCol] + epsilon + ((nrCols > 1) ? (bestValue - secondValue) : 0);
+}
+
+template <typename T>
+size_t AuctionSolver<T>::GetWorkspaceSize() const
+{
+    return GetCapacityBytes(prices, auctionRowAssignment, auctionColAssignment, rowAssignment, colAssignment, biddingRows, bidCols,
+                            nextBiddingRows, bidPrices, bestBidPrice, bestBidRow, biddenCols);
+}
+
+//--------------------Explicit class instantiation types--------------------//
+template class AuctionSolver<int16_t>;
+template class AuctionSolver<uint16_t>;
+template class AuctionSolver<int>;
+template class AuctionSolver<int64_t>;
+template class AuctionSolver<float>;
+template class AuctionSolver<double>;
+//--------------------------------------------------------------------------//
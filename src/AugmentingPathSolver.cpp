@@ -0,0 +1,775 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#include "AugmentingPathSolver.h"
+
+// Minimum number of remaining cols in each chunk of a scan on the thread pool
+#define MIN_PARALLEL_SCAN_COLS 1024
+
+template <typename T>
+AugmentingPathSolver<T>::AugmentingPathSolver()
+    : nrRows(0), nrCols(0), minPathCost(0), searchRow(-1), nrRemainingCols(0), interruptedStartRow(-1), hasSolution(false), hasDirtyLines(false),
+      nrOfScannedRows(0), hasDeadline(false), maxScannedRows(-1), isInterrupted(false), statistics(nullptr), threadPool(nullptr)
+{
+}
+
+template <typename T>
+bool AugmentingPathSolver<T>::Solve(CostMatrixView<T> &costMatrix)
+{
+    nrRows = costMatrix.GetNrRows();
+    nrCols = costMatrix.GetNrCols();
+    if (nrRows > nrCols)
+    {
+        throw std::invalid_argument("The number of rows cannot exceed the number of cols!");
+    }
+    nrOfScannedRows = 0;
+
+    // Start from zero potentials, which are feasible for non-negative costs
+    rowPotential.assign(nrRows, 0);
+    colPotential.assign(nrCols, 0);
+    rowAssignment.assign(nrRows, -1);
+    colAssignment.assign(nrCols, -1);
+    violatedElements.clear();
+    hasDirtyLines = false;
+    interruptedStartRow = -1;
+    PrepareWorkspace();
+
+    // Assign the rows one after the other
+    hasSolution = AugmentFreeRows(costMatrix);
+    return hasSolution;
+}
+
+template <typename T>
+void AugmentingPathSolver<T>::UpdateCost(int row, int col, T oldCost, T newCost)
+{
+    if (!hasSolution)
+    {
+        return;
+    }
+    // The solution stays optimal if the reduced cost remains non-negative (dual feasibility),
+    // and assigned elements keep a zero reduced cost (complementary slackness)
+    double reducedCost = (double)newCost - rowPotential[row] - colPotential[col];
+    if ((reducedCost < 0) || ((rowAssignment[row] == col) && (newCost != oldCost)))
+    {
+        violatedElements.push_back(std::make_pair(row, col));
+    }
+}
+
+template <typename T>
+bool AugmentingPathSolver<T>::Resolve(CostMatrixView<T> &costMatrix)
+{
+    // Solve from scratch if there is no previous solution of the same problem
+    if (!hasSolution || (costMatrix.GetNrRows() != nrRows) || (costMatrix.GetNrCols() != nrCols))
+    {
+        return Solve(costMatrix);
+    }
+    nrOfScannedRows = 0;
+    if (violatedElements.empty() && !hasDirtyLines)
+    {
+        return true;
+    }
+
+    // Cover the violated elements by dirty lines: cols with several violated elements, rows otherwise (in addition to
+    // the dirty lines of a resized problem)
+    if (!hasDirtyLines)
+    {
+        dirtyRows.assign(nrRows, false);
+        dirtyCols.assign(nrCols, false);
+        unbalancedCols.assign(nrCols, false);
+    }
+    hasDirtyLines = false;
+    std::vector<int> &nrViolationsInCol = pathRow;
+    std::fill(nrViolationsInCol.begin(), nrViolationsInCol.end(), 0);
+    for (const auto &element : violatedElements)
+    {
+        nrViolationsInCol[element.second]++;
+    }
+    for (const auto &element : violatedElements)
+    {
+        if (nrViolationsInCol[element.second] > 1)
+        {
+            dirtyCols[element.second] = true;
+        }
+        else
+        {
+            dirtyRows[element.first] = true;
+        }
+    }
+    violatedElements.clear();
+
+    // Repair the dirty lines and assign the released rows again
+    interruptedStartRow = -1;
+    RepairDirtyLines(costMatrix);
+    BalanceFreeCols(costMatrix);
+    hasSolution = AugmentFreeRows(costMatrix);
+    return hasSolution;
+}
+
+template <typename T>
+bool AugmentingPathSolver<T>::Continue(CostMatrixView<T> &costMatrix)
+{
+    if (!isInterrupted || (costMatrix.GetNrRows() != nrRows) || (costMatrix.GetNrCols() != nrCols))
+    {
+        throw std::invalid_argument("There is no interrupted solve of the problem to continue!");
+    }
+    nrOfScannedRows = 0;
+    // The assigned rows and the dual potentials are valid, the search of the first free row continues where it stopped
+    hasSolution = AugmentFreeRows(costMatrix);
+    return hasSolution;
+}
+
+template <typename T>
+void AugmentingPathSolver<T>::SetBudget(const SolveBudget &budget)
+{
+    hasDeadline = (budget.maxTime < std::numeric_limits<double>::infinity());
+    if (hasDeadline)
+    {
+        deadline = std::chrono::steady_clock::now() +
+                   std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(std::max(budget.maxTime, 0.0)));
+    }
+    maxScannedRows = budget.maxIterations;
+}
+
+template <typename T>
+bool AugmentingPathSolver<T>::IsBudgetExhausted() const
+{
+    return ((maxScannedRows >= 0) && (nrOfScannedRows >= maxScannedRows)) || (hasDeadline && (std::chrono::steady_clock::now() >= deadline));
+}
+
+template <typename T>
+double AugmentingPathSolver<T>::CompleteAssignment(CostMatrixView<T> &costMatrix, std::vector<int> &completedRowAssignment,
+                                                   std::vector<int> &completedColAssignment, double &lowerBound) const
+{
+    completedRowAssignment.assign(rowAssignment.begin(), rowAssignment.end());
+    completedColAssignment.assign(colAssignment.begin(), colAssignment.end());
+
+    // Lower bound: the dual objective of feasible potentials (the col potentials are not positive for rectangular
+    // problems), with the potential of each free row raised to its smallest reduced cost
+    double totalCost = 0;
+    lowerBound = 0;
+    for (int col = 0; col < nrCols; col++)
+    {
+        lowerBound += colPotential[col];
+    }
+    for (int row = 0; row < nrRows; row++)
+    {
+        // The assignments are tight, so their costs are the sums of the potentials (no costs are read)
+        if (rowAssignment[row] != -1)
+        {
+            lowerBound += rowPotential[row];
+            totalCost += rowPotential[row] + colPotential[rowAssignment[row]];
+            continue;
+        }
+        Eigen::Index colStride;
+        const T *costRow = costMatrix.GetRow(row, colStride);
+        double minReducedCost = std::numeric_limits<double>::infinity();
+        double minFreeCost = std::numeric_limits<double>::infinity();
+        int minFreeCol = -1;
+        for (int col = 0; col < nrCols; col++)
+        {
+            double cost = (double)costRow[col * colStride];
+            minReducedCost = std::min(minReducedCost, cost - colPotential[col]);
+            if ((completedColAssignment[col] == -1) && (cost < minFreeCost))
+            {
+                minFreeCost = cost;
+                minFreeCol = col;
+            }
+        }
+        lowerBound += minReducedCost;
+        // There are always free cols left as nrRows <= nrCols
+        completedRowAssignment[row] = minFreeCol;
+        completedColAssignment[minFreeCol] = row;
+        totalCost += minFreeCost;
+    }
+    return totalCost;
+}
+
+template <typename T>
+void AugmentingPathSolver<T>::SetSolution(const std::vector<int> &rowAssignment, const std::vector<double> &rowPotential,
+                                          const std::vector<double> &colPotential)
+{
+    nrRows = (int)rowPotential.size();
+    nrCols = (int)colPotential.size();
+    this->rowAssignment.assign(rowAssignment.begin(), rowAssignment.end());
+    this->rowPotential.assign(rowPotential.begin(), rowPotential.end());
+    this->colPotential.assign(colPotential.begin(), colPotential.end());
+    colAssignment.assign(nrCols, -1);
+    for (int row = 0; row < nrRows; row++)
+    {
+        if (rowAssignment[row] != -1)
+        {
+            colAssignment[rowAssignment[row]] = row;
+        }
+    }
+    violatedElements.clear();
+    hasDirtyLines = false;
+    interruptedStartRow = -1;
+    isInterrupted = false;
+    PrepareWorkspace();
+    hasSolution = true;
+}
+
+template <typename T>
+void AugmentingPathSolver<T>::Resize(const std::vector<int> &previousRows, const std::vector<int> &previousCols, bool isTransposed)
+{
+    if (!hasSolution)
+    {
+        throw std::invalid_argument("There is no solution of the problem to resize!");
+    }
+    if (previousRows.size() > previousCols.size())
+    {
+        throw std::invalid_argument("The number of rows cannot exceed the number of cols!");
+    }
+    // The previous rows become cols of the transposed problem and vice versa
+    std::swap(rowPotential, previousRowPotential);
+    std::swap(colPotential, previousColPotential);
+    std::swap(rowAssignment, previousRowAssignment);
+    std::swap(colAssignment, previousColAssignment);
+    std::swap(dirtyRows, previousDirtyRows);
+    std::swap(dirtyCols, previousDirtyCols);
+    std::swap(unbalancedCols, previousUnbalancedCols);
+    const std::vector<double> &sourceRowPotential = isTransposed ? previousColPotential : previousRowPotential;
+    const std::vector<double> &sourceColPotential = isTransposed ? previousRowPotential : previousColPotential;
+    const std::vector<int> &sourceRowAssignment = isTransposed ? previousColAssignment : previousRowAssignment;
+    const std::vector<char> &sourceDirtyRows = isTransposed ? previousDirtyCols : previousDirtyRows;
+    const std::vector<char> &sourceDirtyCols = isTransposed ? previousDirtyRows : previousDirtyCols;
+    int nrSourceRows = (int)sourceRowPotential.size(), nrSourceCols = (int)sourceColPotential.size();
+    nrRows = (int)previousRows.size();
+    nrCols = (int)previousCols.size();
+
+    // New index of each previous line (-1 if removed)
+    newRowOfSource.assign(nrSourceRows, -1);
+    newColOfSource.assign(nrSourceCols, -1);
+    for (int row = 0; row < nrRows; row++)
+    {
+        if (previousRows[row] != -1)
+        {
+            newRowOfSource[previousRows[row]] = row;
+        }
+    }
+    for (int col = 0; col < nrCols; col++)
+    {
+        if (previousCols[col] != -1)
+        {
+            newColOfSource[previousCols[col]] = col;
+        }
+    }
+
+    // Kept lines keep their potentials and the assignments between them. New rows are dirty (their potentials are
+    // set by the repair) and new cols are unbalanced, as are the lines which already were before (unbalanced cols
+    // of the transposed problem are free rows, which are repaired as dirty rows)
+    rowPotential.resize(nrRows);
+    colPotential.resize(nrCols);
+    rowAssignment.resize(nrRows);
+    colAssignment.assign(nrCols, -1);
+    dirtyRows.resize(nrRows);
+    dirtyCols.resize(nrCols);
+    unbalancedCols.resize(nrCols);
+    for (int col = 0; col < nrCols; col++)
+    {
+        int sourceCol = previousCols[col];
+        colPotential[col] = (sourceCol != -1) ? sourceColPotential[sourceCol] : 0;
+        dirtyCols[col] = (sourceCol != -1) && hasDirtyLines && sourceDirtyCols[sourceCol];
+        unbalancedCols[col] = (sourceCol == -1) || (!isTransposed && hasDirtyLines && previousUnbalancedCols[sourceCol]);
+    }
+    for (int row = 0; row < nrRows; row++)
+    {
+        int sourceRow = previousRows[row];
+        rowPotential[row] = (sourceRow != -1) ? sourceRowPotential[sourceRow] : 0;
+        dirtyRows[row] = (sourceRow == -1) || (hasDirtyLines && (sourceDirtyRows[sourceRow] || (isTransposed && previousUnbalancedCols[sourceRow])));
+        int sourceCol = (sourceRow != -1) ? sourceRowAssignment[sourceRow] : -1;
+        rowAssignment[row] = (sourceCol != -1) ? newColOfSource[sourceCol] : -1;
+        if (rowAssignment[row] != -1)
+        {
+            colAssignment[rowAssignment[row]] = row;
+        }
+    }
+    // Violated elements of the kept lines which are not repaired yet
+    int nrViolatedElements = 0;
+    for (const auto &element : violatedElements)
+    {
+        int row = isTransposed ? newRowOfSource[element.second] : newRowOfSource[element.first];
+        int col = isTransposed ? newColOfSource[element.first] : newColOfSource[element.second];
+        if ((row != -1) && (col != -1))
+        {
+            violatedElements[nrViolatedElements++] = std::make_pair(row, col);
+        }
+    }
+    violatedElements.resize(nrViolatedElements);
+
+    // The cols of a rectangular problem need non-positive potentials (zero if unassigned): shifting all potentials
+    // by the largest col potential keeps the assignments tight, and the free cols with other potentials are unbalanced
+    if (nrRows < nrCols)
+    {
+        double maxColPotential = *std::max_element(colPotential.begin(), colPotential.end());
+        if (maxColPotential > 0)
+        {
+            for (double &potential : rowPotential)
+            {
+                potential += maxColPotential;
+            }
+            for (double &potential : colPotential)
+            {
+                potential -= maxColPotential;
+            }
+        }
+        for (int col = 0; col < nrCols; col++)
+        {
+            unbalancedCols[col] = unbalancedCols[col] || ((colAssignment[col] == -1) && (colPotential[col] != 0));
+        }
+    }
+    hasDirtyLines = true;
+    interruptedStartRow = -1;
+    isInterrupted = false;
+    PrepareWorkspace();
+}
+
+template <typename T>
+void AugmentingPathSolver<T>::PrepareWorkspace()
+{
+    // No reallocation if the problem size does not grow
+    shortestPathCosts.resize(nrCols);
+    pathRow.resize(nrCols);
+    remainingCols.resize(nrCols);
+    visitedRows.resize(nrRows);
+    visitedCols.resize(nrCols);
+}
+
+template <typename T>
+bool AugmentingPathSolver<T>::AugmentFreeRows(CostMatrixView<T> &costMatrix)
+{
+    isInterrupted = false;
+    for (int row = 0; row < nrRows; row++)
+    {
+        if (rowAssignment[row] == -1)
+        {
+            int sinkCol = FindShortestAugmentingPath(costMatrix, row);
+            if (sinkCol < 0)
+            {
+                return false;
+            }
+            AugmentPath(row, sinkCol);
+        }
+    }
+    return true;
+}
+
+template <typename T>
+void AugmentingPathSolver<T>::ReleaseRow(int row)
+{
+    int col = rowAssignment[row];
+    if (col == -1)
+    {
+        return;
+    }
+    rowAssignment[row] = -1;
+    colAssignment[col] = -1;
+    // Unassigned cols of a rectangular problem must have a zero potential (the largest one)
+    if ((nrRows < nrCols) && (colPotential[col] != 0))
+    {
+        releasedCols.push_back(col);
+    }
+}
+
+template <typename T>
+void AugmentingPathSolver<T>::RepairDirtyLines(CostMatrixView<T> &costMatrix)
+{
+    Eigen::Index colStride;
+    releasedCols.clear();
+
+    // Release the assignments of the dirty cols and rows
+    for (int col = 0; col < nrCols; col++)
+    {
+        if (dirtyCols[col])
+        {
+            if (colAssignment[col] != -1)
+            {
+                rowAssignment[colAssignment[col]] = -1;
+                colAssignment[col] = -1;
+            }
+            releasedCols.push_back(col);
+        }
+    }
+    for (int row = 0; row < nrRows; row++)
+    {
+        if (dirtyRows[row])
+        {
+            ReleaseRow(row);
+        }
+    }
+
+    if (nrRows < nrCols)
+    {
+        // Reset the potentials of the released cols to zero, clean rows whose reduced costs
+        // become negative are made dirty, which may release further cols
+        while (!releasedCols.empty())
+        {
+            int col = releasedCols.back();
+            releasedCols.pop_back();
+            colPotential[col] = 0;
+            for (int row = 0; row < nrRows; row++)
+            {
+                if (!dirtyRows[row] && ((double)costMatrix.GetRow(row, colStride)[col * colStride] - rowPotential[row] < 0))
+                {
+                    dirtyRows[row] = true;
+                    ReleaseRow(row);
+                }
+            }
+        }
+    }
+    else
+    {
+        // Set the potentials of the dirty cols to the smallest reduced cost of the clean rows
+        for (int col = 0; col < nrCols; col++)
+        {
+            if (dirtyCols[col])
+            {
+                double minCost = std::numeric_limits<double>::infinity();
+                for (int row = 0; row < nrRows; row++)
+                {
+                    if (!dirtyRows[row])
+                    {
+                        minCost = std::min(minCost, (double)costMatrix.GetRow(row, colStride)[col * colStride] - rowPotential[row]);
+                    }
+                }
+                colPotential[col] = (minCost < std::numeric_limits<double>::infinity()) ? minCost : 0;
+            }
+        }
+    }
+
+    // Set the potentials of the dirty rows to their smallest reduced cost
+    for (int row = 0; row < nrRows; row++)
+    {
+        if (dirtyRows[row])
+        {
+            const T *costRow = costMatrix.GetRow(row, colStride);
+            double minCost = std::numeric_limits<double>::infinity();
+            for (int col = 0; col < nrCols; col++)
+            {
+                minCost = std::min(minCost, (double)costRow[col * colStride] - colPotential[col]);
+            }
+            rowPotential[row] = minCost;
+        }
+    }
+}
+
+template <typename T>
+void AugmentingPathSolver<T>::BalanceFreeCols(CostMatrixView<T> &costMatrix)
+{
+    // Make the potentials of the unbalanced cols feasible for all rows first, as the searches scan all cols
+    Eigen::Index colStride;
+    for (int col = 0; col < nrCols; col++)
+    {
+        if (unbalancedCols[col])
+        {
+            for (int row = 0; row < nrRows; row++)
+            {
+                colPotential[col] = std::min(colPotential[col], (double)costMatrix.GetRow(row, colStride)[col * colStride] - rowPotential[row]);
+            }
+        }
+    }
+    // Only the free cols of rectangular problems need zero potentials
+    if (nrRows < nrCols)
+    {
+        for (int col = 0; col < nrCols; col++)
+        {
+            if (unbalancedCols[col] && (colAssignment[col] == -1) && (colPotential[col] != 0))
+            {
+                BalanceFreeCol(costMatrix, col);
+            }
+        }
+    }
+}
+
+template <typename T>
+void AugmentingPathSolver<T>::BalanceFreeCol(CostMatrixView<T> &costMatrix, int startCol)
+{
+    const double infinity = std::numeric_limits<double>::infinity();
+    Eigen::Index colStride;
+
+    // Grow a tree (Dijkstra) from the col: each col leads through its reduced costs to the rows, and each row leads to
+    // its assigned col. Leaving the tree at a col costs its distance minus its potential (raising it to zero)
+    std::fill(shortestPathCosts.begin(), shortestPathCosts.end(), infinity);
+    std::fill(visitedCols.begin(), visitedCols.end(), false);
+    rowPathCosts.assign(nrRows, infinity);
+    pathCol.resize(nrRows);
+    shortestPathCosts[startCol] = 0;
+    double exitCost = infinity;
+    int exitCol = -1;
+    while (true)
+    {
+        int col = -1;
+        double colCost = infinity;
+        for (int idx = 0; idx < nrCols; idx++)
+        {
+            if (!visitedCols[idx] && (shortestPathCosts[idx] < colCost))
+            {
+                colCost = shortestPathCosts[idx];
+                col = idx;
+            }
+        }
+        if (colCost >= exitCost)
+        {
+            break;
+        }
+        visitedCols[col] = true;
+        nrOfScannedRows++;
+        if (colCost - colPotential[col] < exitCost)
+        {
+            exitCost = colCost - colPotential[col];
+            exitCol = col;
+        }
+        // The assigned row of the col is skipped, so rounding errors in its tight cost cannot close a cycle
+        for (int row = 0; row < nrRows; row++)
+        {
+            int assignedCol = rowAssignment[row];
+            if (assignedCol == col)
+            {
+                continue;
+            }
+            double cost = colCost + (double)costMatrix.GetRow(row, colStride)[col * colStride] - rowPotential[row] - colPotential[col];
+            if (cost < rowPathCosts[row])
+            {
+                rowPathCosts[row] = cost;
+                pathCol[row] = col;
+                if ((assignedCol != -1) && !visitedCols[assignedCol] && (cost < shortestPathCosts[assignedCol]))
+                {
+                    shortestPathCosts[assignedCol] = cost;
+                }
+            }
+        }
+    }
+
+    // Update the potentials of the tree, which keeps them feasible and gives the exit col a zero potential
+    for (int col = 0; col < nrCols; col++)
+    {
+        if (visitedCols[col])
+        {
+            colPotential[col] += exitCost - shortestPathCosts[col];
+        }
+    }
+    for (int row = 0; row < nrRows; row++)
+    {
+        if (rowPathCosts[row] < exitCost)
+        {
+            rowPotential[row] -= exitCost - rowPathCosts[row];
+        }
+    }
+
+    // Move the rows of the path to the previous col, going back from the exit col (which becomes free) to the start col
+    if (exitCol != startCol)
+    {
+        int row = colAssignment[exitCol];
+        colAssignment[exitCol] = -1;
+        while (true)
+        {
+            int col = pathCol[row];
+            int nextRow = colAssignment[col];
+            rowAssignment[row] = col;
+            colAssignment[col] = row;
+            if (col == startCol)
+            {
+                break;
+            }
+            row = nextRow;
+        }
+    }
+}
+
+template <typename T>
+int AugmentingPathSolver<T>::FindShortestAugmentingPath(CostMatrixView<T> &costMatrix, int startRow)
+{
+    const double infinity = std::numeric_limits<double>::infinity();
+
+    // Reset the shortest path tree, unless the interrupted search of the start row is continued
+    if (startRow != interruptedStartRow)
+    {
+        minPathCost = 0;
+        nrRemainingCols = nrCols;
+        for (int idx = 0; idx < nrCols; idx++)
+        {
+            remainingCols[idx] = nrCols - idx - 1;
+        }
+        std::fill(visitedRows.begin(), visitedRows.end(), false);
+        std::fill(visitedCols.begin(), visitedCols.end(), false);
+        std::fill(shortestPathCosts.begin(), shortestPathCosts.end(), infinity);
+        searchRow = startRow;
+    }
+    interruptedStartRow = -1;
+
+    // Grow the tree (Dijkstra) until a free col is reached
+    int sinkCol = -1;
+    while (sinkCol == -1)
+    {
+        // Stop before the next row if the budget runs out, the potentials and assignments are only changed by the
+        // augmentation, so the search can be continued later
+        if (IsBudgetExhausted())
+        {
+            interruptedStartRow = startRow;
+            isInterrupted = true;
+            return -1;
+        }
+        int row = searchRow;
+        visitedRows[row] = true;
+        nrOfScannedRows++;
+        Eigen::Index colStride;
+        const T *costRow = costMatrix.GetRow(row, colStride);
+
+        // Relax the remaining cols through the current row and find the closest one, in chunks on the threads for
+        // large problems
+        int nrChunks = (threadPool != nullptr) ? std::min(threadPool->GetNrThreads(), nrRemainingCols / MIN_PARALLEL_SCAN_COLS) : 1;
+        ScanResult closest;
+        if (nrChunks > 1)
+        {
+            parallelScan = {row, costRow, colStride, nrRemainingCols, nrChunks};
+            chunkResults.resize(nrChunks);
+            // Only this is captured, so the function does not allocate
+            std::function<void(int, int)> scanChunk = [this](int idxChunk, int) {
+                const ParallelScan &scan = parallelScan;
+                chunkResults[idxChunk] = ScanRemainingCols(scan.row, scan.costRow, scan.colStride, (int)((long long)scan.nrRemainingCols * idxChunk / scan.nrChunks),
+                                                           (int)((long long)scan.nrRemainingCols * (idxChunk + 1) / scan.nrChunks));
+            };
+            threadPool->ParallelFor(nrChunks, scanChunk);
+            // Combine the chunks in order with the tie rule of the scan
+            closest = chunkResults[0];
+            for (int idxChunk = 1; idxChunk < nrChunks; idxChunk++)
+            {
+                const ScanResult &result = chunkResults[idxChunk];
+                if ((result.closestCost < closest.closestCost) ||
+                    ((result.closestCost == closest.closestCost) && closest.closestAssigned && !result.closestAssigned))
+                {
+                    closest = result;
+                }
+            }
+        }
+        else
+        {
+            closest = ScanRemainingCols(row, costRow, colStride, 0, nrRemainingCols);
+        }
+
+        // No reachable col left -> the row cannot be assigned
+        minPathCost = closest.closestCost;
+        if (minPathCost == infinity)
+        {
+            return -1;
+        }
+
+        // Add the closest col to the tree and continue from its assigned row
+        int col = remainingCols[closest.idxClosest];
+        visitedCols[col] = true;
+        remainingCols[closest.idxClosest] = remainingCols[--nrRemainingCols];
+        if (colAssignment[col] == -1)
+        {
+            sinkCol = col;
+        }
+        else
+        {
+            searchRow = colAssignment[col];
+        }
+    }
+    return sinkCol;
+}
+
+template <typename T>
+typename AugmentingPathSolver<T>::ScanResult AugmentingPathSolver<T>::ScanRemainingCols(int row, const T *costRow, Eigen::Index colStride, int idxBegin,
+                                                                                       int idxEnd)
+{
+    // Ties are resolved in favor of the first free col, which ends the search earlier
+    ScanResult closest = {-1, std::numeric_limits<double>::infinity(), true};
+    for (int idx = idxBegin; idx < idxEnd; idx++)
+    {
+        int col = remainingCols[idx];
+        double reducedCost = minPathCost + (double)costRow[col * colStride] - rowPotential[row] - colPotential[col];
+        if (reducedCost < shortestPathCosts[col])
+        {
+            pathRow[col] = row;
+            shortestPathCosts[col] = reducedCost;
+        }
+        if ((shortestPathCosts[col] < closest.closestCost) ||
+            ((shortestPathCosts[col] == closest.closestCost) && closest.closestAssigned && (colAssignment[col] == -1)))
+        {
+            closest.closestCost = shortestPathCosts[col];
+            closest.closestAssigned = (colAssignment[col] != -1);
+            closest.idxClosest = idx;
+        }
+    }
+    return closest;
+}
+
+template <typename T>
+void AugmentingPathSolver<T>::AugmentPath(int startRow, int sinkCol)
+{
+    // Update the dual potentials of the rows and cols in the tree
+    rowPotential[startRow] += minPathCost;
+    for (int row = 0; row < nrRows; row++)
+    {
+        if (visitedRows[row] && (row != startRow))
+        {
+            rowPotential[row] += minPathCost - shortestPathCosts[rowAssignment[row]];
+        }
+    }
+    for (int col = 0; col < nrCols; col++)
+    {
+        if (visitedCols[col])
+        {
+            colPotential[col] -= minPathCost - shortestPathCosts[col];
+        }
+    }
+
+    // Flip the assignments along the path, going back from the sink col to the start row
+    int col = sinkCol;
+    HUNGARIAN_STATS(int pathLength = 0);
+    while (true)
+    {
+        int row = pathRow[col];
+        colAssignment[col] = row;
+        std::swap(rowAssignment[row], col);
+        HUNGARIAN_STATS(pathLength++);
+        if (row == startRow)
+        {
+            break;
+        }
+    }
+    HUNGARIAN_STATS(if (statistics) statistics->AddAugmentingPath(pathLength));
+}
+
+template <typename T>
+size_t AugmentingPathSolver<T>::GetWorkspaceSize() const
+{
+    return GetCapacityBytes(rowPotential, colPotential, rowAssignment, colAssignment, shortestPathCosts, pathRow, remainingCols,
+                            visitedRows, visitedCols, violatedElements, dirtyRows, dirtyCols, releasedCols, chunkResults, previousRowPotential,
+                            previousColPotential, previousRowAssignment, previousColAssignment, previousDirtyRows, previousDirtyCols, newRowOfSource,
+                            newColOfSource, unbalancedCols, previousUnbalancedCols, rowPathCosts, pathCol);
+}
+
+//--------------------Explicit class instantiation types--------------------//
+template class AugmentingPathSolver<int16_t>;
+template class AugmentingPathSolver<uint16_t>;
+template class AugmentingPathSolver<int>;
+template class AugmentingPathSolver<int64_t>;
+template class AugmentingPathSolver<float>;
+template class AugmentingPathSolver<double>;
+//--------------------------------------------------------------------------//
@@ -0,0 +1,309 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#include "BatchFile.h"
+#include <cstring>
+#include <limits>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Identification and version of the file format
+static const char batchFileMagic[8] = {'H', 'U', 'N', 'G', 'B', 'T', 'C', 'H'};
+static const uint32_t batchFileVersion = 1;
+// Size of the header and of an index entry in bytes
+static const size_t batchHeaderSize = 32;
+static const size_t batchIndexEntrySize = 16;
+// Alignment of the payloads in bytes
+static const uint64_t batchPayloadAlignment = 8;
+
+// Size of the costs of each value type in bytes
+static const size_t batchValueSize[] = {sizeof(int32_t), sizeof(float), sizeof(double), sizeof(int16_t), sizeof(uint16_t), sizeof(int64_t)};
+
+// Read a number stored in native byte order
+template <typename U>
+static U ReadNumber(const unsigned char *data)
+{
+    U number;
+    std::memcpy(&number, data, sizeof(U));
+    return number;
+}
+
+template <typename T>
+BatchFileWriter<T>::BatchFileWriter(const std::string &path) : fileSize(batchHeaderSize)
+{
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        throw std::runtime_error("The batch file cannot be created!");
+    }
+    // The header is completed by Close()
+    const char header[batchHeaderSize] = {};
+    file.write(header, batchHeaderSize);
+}
+
+template <typename T>
+BatchFileWriter<T>::~BatchFileWriter()
+{
+    if (file.is_open())
+    {
+        try
+        {
+            Close();
+        }
+        catch (...)
+        {
+        }
+    }
+}
+
+template <typename T>
+int BatchFileWriter<T>::AddCostFunctionMatrix(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &costFcnMatrix)
+{
+    Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> rowMajorMatrix = costFcnMatrix;
+    return AddCostFunctionMatrix(rowMajorMatrix.data(), (int)rowMajorMatrix.rows(), (int)rowMajorMatrix.cols());
+}
+
+template <typename T>
+int BatchFileWriter<T>::AddCostFunctionMatrix(const T *rowMajorCosts, int nrRows, int nrCols)
+{
+    if (!file.is_open())
+    {
+        throw std::invalid_argument("The batch file is already closed!");
+    }
+    if ((nrRows < 0) || (nrCols < 0))
+    {
+        throw std::invalid_argument("The cost function matrix dimensions cannot be negative!");
+    }
+    // Pad the file to the alignment of the payloads
+    static const char padding[batchPayloadAlignment] = {};
+    uint64_t paddingSize = (batchPayloadAlignment - fileSize % batchPayloadAlignment) % batchPayloadAlignment;
+    file.write(padding, paddingSize);
+    fileSize += paddingSize;
+
+    size_t payloadSize = (size_t)nrRows * nrCols * sizeof(T);
+    file.write(reinterpret_cast<const char *>(rowMajorCosts), payloadSize);
+    if (!file)
+    {
+        throw std::runtime_error("The batch file cannot be written!");
+    }
+    payloadOffsets.push_back(fileSize);
+    problemRows.push_back(nrRows);
+    problemCols.push_back(nrCols);
+    fileSize += payloadSize;
+    return GetNrOfProblems() - 1;
+}
+
+template <typename T>
+void BatchFileWriter<T>::Close()
+{
+    if (!file.is_open())
+    {
+        return;
+    }
+    // Write the index at the end of the file
+    uint64_t indexOffset = fileSize;
+    for (int problemIdx = 0; problemIdx < GetNrOfProblems(); problemIdx++)
+    {
+        unsigned char entry[batchIndexEntrySize];
+        std::memcpy(entry, &payloadOffsets[problemIdx], sizeof(uint64_t));
+        std::memcpy(entry + 8, &problemRows[problemIdx], sizeof(uint32_t));
+        std::memcpy(entry + 12, &problemCols[problemIdx], sizeof(uint32_t));
+        file.write(reinterpret_cast<const char *>(entry), batchIndexEntrySize);
+    }
+
+    // Complete the header
+    unsigned char header[batchHeaderSize];
+    uint32_t valueType = BatchValueTypeOf<T>::value;
+    uint64_t nrProblems = GetNrOfProblems();
+    std::memcpy(header, batchFileMagic, sizeof(batchFileMagic));
+    std::memcpy(header + 8, &batchFileVersion, sizeof(uint32_t));
+    std::memcpy(header + 12, &valueType, sizeof(uint32_t));
+    std::memcpy(header + 16, &nrProblems, sizeof(uint64_t));
+    std::memcpy(header + 24, &indexOffset, sizeof(uint64_t));
+    file.seekp(0);
+    file.write(reinterpret_cast<const char *>(header), batchHeaderSize);
+    file.close();
+    if (file.fail())
+    {
+        throw std::runtime_error("The batch file cannot be written!");
+    }
+}
+
+BatchFileReader::BatchFileReader(const std::string &path) : mappedData(nullptr), mappedSize(0), valueType(BatchValueType::BatchInt32), nrProblems(0), indexData(nullptr)
+{
+#ifndef _WIN32
+    int fileDescriptor = open(path.c_str(), O_RDONLY);
+    if (fileDescriptor < 0)
+    {
+        throw std::runtime_error("The batch file cannot be opened!");
+    }
+    struct stat fileStatus;
+    if ((fstat(fileDescriptor, &fileStatus) != 0) || (fileStatus.st_size < (off_t)batchHeaderSize))
+    {
+        close(fileDescriptor);
+        throw std::invalid_argument("The batch file has no valid header!");
+    }
+    mappedSize = (size_t)fileStatus.st_size;
+    void *mapping = mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    // The mapping stays valid after closing the file
+    close(fileDescriptor);
+    if (mapping == MAP_FAILED)
+    {
+        throw std::runtime_error("The batch file cannot be memory-mapped!");
+    }
+    mappedData = static_cast<const unsigned char *>(mapping);
+#else
+    throw std::runtime_error("Memory-mapped batch files are only supported on POSIX systems!");
+#endif
+
+    // Check the header
+    uint32_t version = ReadNumber<uint32_t>(mappedData + 8);
+    uint32_t type = ReadNumber<uint32_t>(mappedData + 12);
+    uint64_t nrFileProblems = ReadNumber<uint64_t>(mappedData + 16);
+    uint64_t indexOffset = ReadNumber<uint64_t>(mappedData + 24);
+    if ((std::memcmp(mappedData, batchFileMagic, sizeof(batchFileMagic)) != 0) || (version != batchFileVersion) ||
+        (type > BatchValueType::BatchInt64) || (nrFileProblems > (uint64_t)std::numeric_limits<int>::max()) ||
+        (indexOffset < batchHeaderSize) || (indexOffset > mappedSize) || ((mappedSize - indexOffset) / batchIndexEntrySize < nrFileProblems))
+    {
+        Unmap();
+        throw std::invalid_argument("The batch file has no valid header!");
+    }
+    valueType = (BatchValueType)type;
+    nrProblems = (int)nrFileProblems;
+    indexData = mappedData + indexOffset;
+
+    // Check that all payloads are aligned and lie between the header and the index
+    for (int problemIdx = 0; problemIdx < nrProblems; problemIdx++)
+    {
+        uint64_t payloadOffset = GetPayloadOffset(problemIdx);
+        uint64_t nrRows = ReadNumber<uint32_t>(indexData + problemIdx * batchIndexEntrySize + 8);
+        uint64_t nrCols = ReadNumber<uint32_t>(indexData + problemIdx * batchIndexEntrySize + 12);
+        if ((payloadOffset < batchHeaderSize) || (payloadOffset % batchPayloadAlignment != 0) || (payloadOffset > indexOffset) ||
+            (nrRows > (uint64_t)std::numeric_limits<int>::max()) || (nrCols > (uint64_t)std::numeric_limits<int>::max()) ||
+            ((nrCols != 0) && (nrRows > (indexOffset - payloadOffset) / batchValueSize[valueType] / nrCols)))
+        {
+            Unmap();
+            throw std::invalid_argument("The batch file index is not valid!");
+        }
+    }
+}
+
+BatchFileReader::~BatchFileReader()
+{
+    Unmap();
+}
+
+void BatchFileReader::Unmap()
+{
+#ifndef _WIN32
+    if (mappedData != nullptr)
+    {
+        munmap(const_cast<unsigned char *>(mappedData), mappedSize);
+        mappedData = nullptr;
+    }
+#endif
+}
+
+uint64_t BatchFileReader::GetPayloadOffset(int problemIdx) const
+{
+    return ReadNumber<uint64_t>(indexData + problemIdx * batchIndexEntrySize);
+}
+
+void BatchFileReader::CheckProblemIndex(int problemIdx) const
+{
+    if ((problemIdx < 0) || (problemIdx >= nrProblems))
+    {
+        throw std::invalid_argument("The problem index is out of range of the batch file!");
+    }
+}
+
+int BatchFileReader::GetNrRows(int problemIdx) const
+{
+    CheckProblemIndex(problemIdx);
+    return (int)ReadNumber<uint32_t>(indexData + problemIdx * batchIndexEntrySize + 8);
+}
+
+int BatchFileReader::GetNrCols(int problemIdx) const
+{
+    CheckProblemIndex(problemIdx);
+    return (int)ReadNumber<uint32_t>(indexData + problemIdx * batchIndexEntrySize + 12);
+}
+
+void BatchFileReader::AdviseSequential()
+{
+#ifndef _WIN32
+    madvise(const_cast<unsigned char *>(mappedData), mappedSize, MADV_SEQUENTIAL);
+#endif
+}
+
+void BatchFileReader::ReleaseProblems(int firstIdx, int lastIdx)
+{
+    if ((firstIdx < 0) || (lastIdx > nrProblems) || (firstIdx >= lastIdx))
+    {
+        return;
+    }
+#ifndef _WIN32
+    // Only whole pages inside the payloads of the problems are released
+    uint64_t pageSize = (uint64_t)sysconf(_SC_PAGESIZE);
+    uint64_t begin = GetPayloadOffset(firstIdx);
+    uint64_t end = (lastIdx < nrProblems) ? GetPayloadOffset(lastIdx) : (uint64_t)(indexData - mappedData);
+    begin = (begin + pageSize - 1) / pageSize * pageSize;
+    end = end / pageSize * pageSize;
+    if (begin < end)
+    {
+        madvise(const_cast<unsigned char *>(mappedData) + begin, end - begin, MADV_DONTNEED);
+    }
+#endif
+}
+
+void BatchFileReader::ReleasePages(const void *data, size_t nrBytes)
+{
+#ifndef _WIN32
+    // All pages touching the bytes are released, the mapping starts at a page boundary and covers its last page
+    uint64_t pageSize = (uint64_t)sysconf(_SC_PAGESIZE);
+    uint64_t begin = (uint64_t)(static_cast<const unsigned char *>(data) - mappedData);
+    uint64_t end = begin + nrBytes;
+    begin = begin / pageSize * pageSize;
+    end = (end + pageSize - 1) / pageSize * pageSize;
+    if (begin < end)
+    {
+        madvise(const_cast<unsigned char *>(mappedData) + begin, end - begin, MADV_DONTNEED);
+    }
+#endif
+}
+
+//--------------------Explicit class instantiation types--------------------//
+template class BatchFileWriter<int16_t>;
+template class BatchFileWriter<uint16_t>;
+template class BatchFileWriter<int>;
+template class BatchFileWriter<int64_t>;
+template class BatchFileWriter<float>;
+template class BatchFileWriter<double>;
+//--------------------------------------------------------------------------//
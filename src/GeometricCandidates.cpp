@@ -0,0 +1,153 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#include "GeometricCandidates.h"
+
+template <typename T>
+void GeometricCandidates<T>::Build(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &rowPoints,
+                                   const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &colPoints, double maxDistance)
+{
+    if (rowPoints.cols() != colPoints.cols())
+    {
+        throw std::invalid_argument("The row and col points must have the same dimension!");
+    }
+    if ((rowPoints.cols() < 1) || (rowPoints.cols() > MAX_GEOMETRIC_DIMS))
+    {
+        throw std::invalid_argument("The points must have 1 to 3 dimensions!");
+    }
+    if (!(maxDistance > 0) || !std::isfinite(maxDistance))
+    {
+        throw std::invalid_argument("The gate distance must be positive and finite!");
+    }
+    if (maxDistance > (double)CostRange<T>::GetMaxCost())
+    {
+        throw std::invalid_argument("The gate distance exceeds the largest cost of the type!");
+    }
+    if (!rowPoints.allFinite() || !colPoints.allFinite())
+    {
+        throw std::invalid_argument("The points must have finite coordinates!");
+    }
+    nrRows = (int)rowPoints.rows();
+    nrCols = (int)colPoints.rows();
+    nrDims = (int)rowPoints.cols();
+
+    // Sort the col points by their grid cell (ties by index, so the order is deterministic)
+    sortedColCells.resize(nrCols);
+    for (int col = 0; col < nrCols; col++)
+    {
+        sortedColCells[col] = std::make_pair(GetCell(colPoints, col, maxDistance), col);
+    }
+    std::sort(sortedColCells.begin(), sortedColCells.end());
+
+    // Check the col points of the neighboring cells of each row point
+    double maxSquaredDistance = maxDistance * maxDistance;
+    int nrPrefixCells = 1;
+    for (int dim = 0; dim < nrDims - 1; dim++)
+    {
+        nrPrefixCells *= 3;
+    }
+    rowOffsets.resize(nrRows + 1);
+    rowOffsets[0] = 0;
+    colIndices.clear();
+    costs.clear();
+    for (int row = 0; row < nrRows; row++)
+    {
+        GridCell rowCell = GetCell(rowPoints, row, maxDistance);
+        rowCandidates.clear();
+        for (int idxPrefix = 0; idxPrefix < nrPrefixCells; idxPrefix++)
+        {
+            // Offsets -1, 0, 1 of the first dimensions, the last dimension covers its three cells in one range
+            GridCell firstCell = rowCell, lastCell = rowCell;
+            int code = idxPrefix;
+            for (int dim = 0; dim < nrDims - 1; dim++)
+            {
+                firstCell[dim] += code % 3 - 1;
+                lastCell[dim] = firstCell[dim];
+                code /= 3;
+            }
+            firstCell[nrDims - 1]--;
+            lastCell[nrDims - 1]++;
+            auto first = std::lower_bound(sortedColCells.begin(), sortedColCells.end(), std::make_pair(firstCell, -1));
+            auto last = std::lower_bound(first, sortedColCells.end(), std::make_pair(lastCell, nrCols));
+            for (auto it = first; it != last; ++it)
+            {
+                int col = it->second;
+                double squaredDistance = 0;
+                for (int dim = 0; dim < nrDims; dim++)
+                {
+                    double difference = (double)rowPoints(row, dim) - (double)colPoints(col, dim);
+                    squaredDistance += difference * difference;
+                }
+                if (squaredDistance <= maxSquaredDistance)
+                {
+                    double distance = std::sqrt(squaredDistance);
+                    rowCandidates.push_back(std::make_pair(col, std::is_integral<T>::value ? (T)std::llround(distance) : (T)distance));
+                }
+            }
+        }
+        // The sparse solvers expect the cols of a row in increasing order
+        std::sort(rowCandidates.begin(), rowCandidates.end());
+        for (const auto &candidate : rowCandidates)
+        {
+            colIndices.push_back(candidate.first);
+            costs.push_back(candidate.second);
+        }
+        rowOffsets[row + 1] = (int)colIndices.size();
+    }
+}
+
+template <typename T>
+typename GeometricCandidates<T>::GridCell GeometricCandidates<T>::GetCell(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &points, int idx,
+                                                                         double cellSize) const
+{
+    GridCell cell = {0, 0, 0};
+    for (int dim = 0; dim < nrDims; dim++)
+    {
+        double coordinate = std::floor((double)points(idx, dim) / cellSize);
+        // The neighbors of the cell must be representable
+        if (std::abs(coordinate) > 1e18)
+        {
+            throw std::invalid_argument("The point coordinates are too large for the gate distance!");
+        }
+        cell[dim] = (long long)coordinate;
+    }
+    return cell;
+}
+
+template <typename T>
+size_t GeometricCandidates<T>::GetWorkspaceSize() const
+{
+    return GetCapacityBytes(sortedColCells, rowOffsets, colIndices, costs, rowCandidates);
+}
+
+//--------------------Explicit class instantiation types--------------------//
+template class GeometricCandidates<int16_t>;
+template class GeometricCandidates<uint16_t>;
+template class GeometricCandidates<int>;
+template class GeometricCandidates<int64_t>;
+template class GeometricCandidates<float>;
+template class GeometricCandidates<double>;
+//--------------------------------------------------------------------------//
@@ -1,497 +1,1389 @@
-//----------------------------------------------------------------------------------//
-// MIT License
-//
-// Copyright (c) [2020-] [Mostafa Emam]
-//
-// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-//----------------------------------------------------------------------------------//
-
-#include "HungarianAlgorithm.h"
-
-template <typename T>
-HungarianAlgorithm<T>::HungarianAlgorithm() {}
-
-template <class T>
-HungarianAlgorithm<T>::HungarianAlgorithm(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &costFcnMatrix)
-{
-    // Set cost function matrix
-    SetCostFunctionMatrix(costFcnMatrix);
-    // Update problemStatus
-    problemStatus = ProblemStatus::ReadyToSolve;
-}
-
-template <typename T>
-void HungarianAlgorithm<T>::SetCostFunctionMatrix(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &costFcnMatrix)
-{
-    // Check if the input matrix contains any negative values
-    if ((costFcnMatrix.array() < 0).any())
-    {
-        throw std::invalid_argument("The cost function matrix cannot contain negative values!");
-    }
-
-    // Set the dummy cost as a very large number
-    dummyCost = (costFcnMatrix.maxCoeff() + 100);
-    // Save the matrix size
-    nrRows = (int)costFcnMatrix.rows();
-    nrCols = (int)costFcnMatrix.cols();
-    // Check if the costFunctionMatrix is not square
-    if (nrRows != nrCols)
-    {
-        // Get the size for the used matrices
-        matrixSize = std::max(nrCols, nrRows);
-        // Initialize cost function matrix with the dummyCost
-        costFunctionMatrix.resize(matrixSize, matrixSize);
-        costFunctionMatrix.fill(dummyCost);
-        // Copy relevant data from the costFunctionMatrix
-        costFunctionMatrix.block(0, 0, nrRows, nrCols) = costFcnMatrix;
-    }
-    else
-    {
-        // Get the size for the used matrices
-        matrixSize = nrRows;
-        // Initialize cost function matrix with input matrix
-        costFunctionMatrix.resize(matrixSize, matrixSize);
-        costFunctionMatrix = costFcnMatrix;
-    }
-    // Copy the costFunctionMatrix contents to the workingMatrix
-    workingMatrix = costFunctionMatrix;
-    // Initialize coveredMatrix with false
-    coveredMatrix.resize(matrixSize, matrixSize);
-    coveredMatrix.fill(false);
-    // Initialize assignmentMatrix with false
-    assignmentMatrix.resize(matrixSize, matrixSize);
-    assignmentMatrix.fill(false);
-    // Update problemStatus
-    problemStatus = ProblemStatus::ReadyToSolve;
-}
-
-template <typename T>
-void HungarianAlgorithm<T>::GetCostFunctionMatrix(Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &outMatrix)
-{
-    if (problemStatus < ProblemStatus::ReadyToSolve)
-    {
-        throw std::invalid_argument("The cost function matrix is undefined!");
-    }
-    if ((outMatrix.rows() != nrRows) || (outMatrix.cols() != nrCols))
-    {
-        throw std::invalid_argument("The input matrix dimensions is inconsistent with the cost function matrix!");
-    }
-    // Copy cost function matrix to the output
-    outMatrix = costFunctionMatrix;
-}
-
-template <typename T>
-void HungarianAlgorithm<T>::GetAssignmentMatrix(Eigen::Matrix<int, Eigen::Dynamic, Eigen::Dynamic> &outMatrix)
-{
-    if (problemStatus < ProblemStatus::Done)
-    {
-        throw std::invalid_argument("The assignment problem has not been solved yet!");
-    }
-    if ((outMatrix.rows() != nrRows) || (outMatrix.cols() != nrCols))
-    {
-        throw std::invalid_argument("The input matrix dimensions is inconsistent with the assignment matrix!");
-    }
-    // Copy assignment matrix to the output
-    outMatrix = assignmentMatrix.block(0, 0, nrRows, nrCols).cast<int>();
-}
-
-template <typename T>
-void HungarianAlgorithm<T>::GetAssignmentResults(std::vector<int> &rowIndices, std::vector<int> &colIndices)
-{
-    if (problemStatus < ProblemStatus::Done)
-    {
-        throw std::invalid_argument("The assignment problem has not been solved yet!");
-    }
-    if (rowIndices.size() != nrRows)
-    {
-        throw std::invalid_argument("The input row vector size is inconsistent with the number of rows!");
-    }
-    if (colIndices.size() != nrCols)
-    {
-        throw std::invalid_argument("The input col vector size is inconsistent with the number of cols!");
-    }
-    // Initialize output vector data with (-1)
-    std::fill(rowIndices.begin(), rowIndices.end(), -1);
-    std::fill(colIndices.begin(), colIndices.end(), -1);
-    // Loop on all elements in the assignmentMatrix
-    for (int row = 0; row < nrRows; row++)
-    {
-        for (int col = 0; col < nrCols; col++)
-        {
-            if (assignmentMatrix(row, col))
-            {
-                // Save the valid index data
-                rowIndices[row] = col;
-                colIndices[col] = row;
-            }
-        }
-    }
-}
-
-template <typename T>
-void HungarianAlgorithm<T>::SolveAssignmentProblem()
-{
-    if (problemStatus < ProblemStatus::ReadyToSolve)
-    {
-        throw std::invalid_argument("The cost function matrix is undefined!");
-    }
-    // Execute the Hungarian algorithm sequence
-    if (nrRows >= nrCols)
-    {
-        // Step 1
-        SubtractRowMinima();
-        // Step 2
-        SubtractColMinima();
-    }
-    else
-    {
-        // Reverse the order
-        // Step 2
-        SubtractColMinima();
-        // Step 1
-        SubtractRowMinima();
-    }
-    // Step 3
-    while (MinNrOfLinesToCoverAllZeros() != matrixSize)
-    {
-        // Step 4
-        AugmentCostFunctionMatrix();
-    }
-    // Step 5
-    FindOptimalCost();
-    // Assignment is done
-    problemStatus = ProblemStatus::Done;
-}
-
-template <typename T>
-void HungarianAlgorithm<T>::SubtractRowMinima()
-{
-    // Subtract the minimum value in each row
-    for (int row = 0; row < matrixSize; row++)
-    {
-        T rowMinCoeff = workingMatrix.row(row).minCoeff();
-        // Do the operation only if the coeff value is non-zero (reduces operation time)
-        if (!IsApproxZERO(rowMinCoeff))
-        {
-            workingMatrix.row(row).array() -= rowMinCoeff;
-        }
-    }
-}
-
-template <typename T>
-void HungarianAlgorithm<T>::SubtractColMinima()
-{
-    // Subtract the minimum value in each column
-    for (int col = 0; col < matrixSize; col++)
-    {
-        T colMinCoeff = workingMatrix.col(col).minCoeff();
-        // Do the operation only if the coeff value is non-zero (reduces operation time)
-        if (!IsApproxZERO(colMinCoeff))
-        {
-            workingMatrix.col(col).array() -= colMinCoeff;
-        }
-    }
-}
-
-template <typename T>
-int HungarianAlgorithm<T>::MinNrOfLinesToCoverAllZeros()
-{
-    // Reset the variables used to check the covered elements in the matrix
-    coveredMatrix.fill(false);
-    nrLinesToCoverZeroes = 0;
-
-    // Total number of uncovered zeroes in the workingMatrix
-    //(workingMatrix == 0).count()
-    int nrUncoveredZeroes = (int)(IsApproxZERO(workingMatrix.array())).count();
-
-    // Loop till all elements are checked
-    while (nrUncoveredZeroes > 0)
-    {
-        // Check if a new zero was covered in this iteration
-        bool newZeroCovered = false;
-
-        // Start looking from the first uncovered zero
-        //((workingMatrix == 0) && (!coveredMatrix)).index()
-        int idxRow, idxCol;
-        (IsApproxZERO(workingMatrix.array()) && (!coveredMatrix.array())).maxCoeff(&idxRow, &idxCol);
-
-        // Loop on all elements in the workingMatrix
-        for (int row = idxRow; row < matrixSize; row++)
-        {
-            for (int col = idxCol; col < matrixSize; col++)
-            {
-                // Check only uncovered elements
-                if (!coveredMatrix(row, col))
-                {
-                    // Check zero elements in the workingMatrix (with a certain precision)
-                    if (IsApproxZERO(workingMatrix(row, col)))
-                    {
-                        // Check the total number of uncovered zero elements in the same row of the current zero element
-                        //((workingMatrix.row() == 0) && (!coveredMatrix.row())).count()
-                        int nrZeroesInRow = (int)(IsApproxZERO(workingMatrix.row(row).array()) && (!coveredMatrix.row(row).array())).count();
-
-                        // Check the total number of uncovered zero elements in the same column of the current zero element
-                        //((workingMatrix.col() == 0) && (!coveredMatrix.col())).count()
-                        int nrZeroesInCol = (int)(IsApproxZERO(workingMatrix.col(col).array()) && (!coveredMatrix.col(col).array())).count();
-
-                        // Check if multiple zeroes were found
-                        if ((nrZeroesInRow > 1) || (nrZeroesInCol > 1))
-                        {
-                            // If (total number of uncovered zeroes in the row) > (total number of uncovered zeroes in the column) -> Cover the row
-                            if (nrZeroesInRow > nrZeroesInCol)
-                            {
-                                // Cover the row
-                                coveredMatrix.row(row).fill(true);
-                                nrLinesToCoverZeroes++;
-                                nrUncoveredZeroes -= nrZeroesInRow;
-                                // A new zero was covered
-                                newZeroCovered = true;
-                            }
-                            // Else if (total number of uncovered zeroes in the row) < (total number of uncovered zeroes in the column) -> Cover the column
-                            else if (nrZeroesInRow < nrZeroesInCol)
-                            {
-                                // Cover the column
-                                coveredMatrix.col(col).fill(true);
-                                nrLinesToCoverZeroes++;
-                                nrUncoveredZeroes -= nrZeroesInCol;
-                                // A new zero was covered
-                                newZeroCovered = true;
-                            }
-                            // Else -> Skip element
-                            else
-                            {
-                                // A decision cannot be made based on this element alone to cover the row or the column
-                                // The next zeroes in the row/column will be checked before deciding
-                            }
-                        }
-                        else
-                        {
-                            // Only one zero was found
-                            // No difference in covering the row or the column, cover the row
-                            coveredMatrix.row(row).fill(true);
-                            nrLinesToCoverZeroes++;
-                            nrUncoveredZeroes -= nrZeroesInRow;
-                            // A new zero was covered
-                            newZeroCovered = true;
-                        }
-                        // If all zeroes are covered, no need for further checking
-                        if (nrUncoveredZeroes == 0)
-                        {
-                            return (nrLinesToCoverZeroes);
-                        }
-                    }
-                }
-            }
-        }
-
-        // Check if no new zeroes were covered in this iteration
-        if (!newZeroCovered)
-        {
-            // Multiple solutions are possible -> Cover the row for any set of zeroes
-            // Find the index of the first uncovered zero
-            //((workingMatrix == 0) && (!coveredMatrix)).index()
-            int idxRow, idxCol;
-            (IsApproxZERO(workingMatrix.array()) && (!coveredMatrix.array())).maxCoeff(&idxRow, &idxCol);
-            // Find the total number of uncovered zeroes in its row
-            int nrZeroesInRow = (int)(IsApproxZERO(workingMatrix.row(idxRow).array()) && (!coveredMatrix.row(idxRow).array())).count();
-            // Cover the row
-            coveredMatrix.row(idxRow).fill(true);
-            nrLinesToCoverZeroes++;
-            nrUncoveredZeroes -= nrZeroesInRow;
-        }
-    }
-    // return the total number of lines needed to cover the zeroes in the workingMatrix
-    return (nrLinesToCoverZeroes);
-}
-
-template <typename T>
-void HungarianAlgorithm<T>::AugmentCostFunctionMatrix()
-{
-    // Find the minimum value of the uncovered elements
-    //((maskMatrix == condition) ? (A) : (B)).minCoeff
-    //((!coveredMatrix) ? (workingMatrix) : (dummyCost)).minCoeff()
-    //(dummyCost+1) since costFunctionMatrix may contain the dummyCost
-    T minUncoveredCoeff = (!coveredMatrix.array()).select((workingMatrix.array()), (dummyCost + 1)).minCoeff();
-
-    // Subtract the minimum value from the uncovered elements
-    //((maskMatrix == condition) ? (A) : (B))
-    //((!coveredMatrix) ? (workingMatrix - minCoeff) : (workingMatrix))
-    workingMatrix = (!coveredMatrix.array()).select((workingMatrix.array() - minUncoveredCoeff), workingMatrix.array());
-
-    // Check the elements covered by more than one line (at the intersection of a vertical and horizontal line)
-    for (int row = 0; row < matrixSize; row++)
-    {
-        for (int col = 0; col < matrixSize; col++)
-        {
-            // If row is covered && column is covered -> element is at intersection -> add the minUncoveredCoeff
-            if ((coveredMatrix.row(row).all()) && (coveredMatrix.col(col).all()))
-            {
-                // Add the minimum value to the elements at the intersection of two lines
-                workingMatrix(row, col) += minUncoveredCoeff;
-            }
-        }
-    }
-}
-
-template <typename T>
-void HungarianAlgorithm<T>::FindOptimalCost()
-{
-    // Find the zeroes in the workingMatrix
-    //((maskMatrix == condition) ? (A) : (B))
-    //(workingMatrix <= 0 ? (true) : (false))
-    assignmentMatrix = (IsApproxZERO(workingMatrix.array())).select(true, assignmentMatrix.array());
-
-    // Check if direct assignment is possible
-    // Condition: Total number of assignments == number of elements to be assigned
-    //(Example: Matrix contains 4 elements -> total of 4 assignments)
-    if ((assignmentMatrix.count()) == matrixSize)
-    {
-        return;
-    }
-    else
-    {
-        // This matrix will be reused to cover the assignments made in the assignmentMatrix
-        coveredMatrix.fill(false);
-
-        // Loop until all elements in the matrix are checked
-        while (!coveredMatrix.all())
-        {
-            // Check if a new assignment was made in this iteration
-            bool newAssignmentMade = false;
-
-            // Check if a row contains a single zero
-            for (int row = 0; row < matrixSize; row++)
-            {
-                // Check only rows with uncovered elements
-                if (!coveredMatrix.row(row).all())
-                {
-                    // If a row contains a single zero -> Directly assign that element, exclude the row and colummn from future checking
-                    if ((assignmentMatrix.row(row).count()) == 1)
-                    {
-                        // A new assignment was made in this iteration
-                        newAssignmentMade = true;
-
-                        // Find the element position
-                        int idxCol;
-                        assignmentMatrix.row(row).maxCoeff(&idxCol);
-
-                        // Clear all other possible assignments in the corresponding column (if any are present)
-                        assignmentMatrix.col(idxCol).fill(false);
-                        // Assign the element
-                        assignmentMatrix(row, idxCol) = true;
-
-                        // Exclude row and column from future checking/assignments
-                        coveredMatrix.row(row).fill(true);
-                        coveredMatrix.col(idxCol).fill(true);
-
-                        // Check if the assignment is complete
-                        if (coveredMatrix.all())
-                        {
-                            return;
-                        }
-                    }
-                }
-            }
-
-            // Check if a column contains a single zero
-            for (int col = 0; col < matrixSize; col++)
-            {
-                // Check only columns with uncovered elements
-                if (!coveredMatrix.col(col).all())
-                {
-                    // If a column contains a single zero -> Directly assign that element, exclude the row and colummn from future checking
-                    if ((assignmentMatrix.col(col).count()) == 1)
-                    {
-                        // A new assignment was made in this iteration
-                        newAssignmentMade = true;
-
-                        // Find the element position
-                        int idxRow;
-                        assignmentMatrix.col(col).maxCoeff(&idxRow);
-
-                        // Clear all other possible assignments in the corresponding column (if any are present)
-                        assignmentMatrix.row(idxRow).fill(false);
-                        // Assign the element
-                        assignmentMatrix(idxRow, col) = true;
-
-                        // Exclude row and column from future checking/assignments
-                        coveredMatrix.row(idxRow).fill(true);
-                        coveredMatrix.col(col).fill(true);
-
-                        // Check if the assignment is complete
-                        if (coveredMatrix.all())
-                        {
-                            return;
-                        }
-                    }
-                }
-            }
-
-            // Check if no new assignments were made in this iteration
-            if (!newAssignmentMade)
-            {
-                // Since the assignment is not yet complete, this means that the assignment problem has multiple possible solutions
-                // Choose a possible solution: (!(coveredMatrix.array()) && (assignmentMatrix.array())).maxCoeff(&idxRow, &idxCol);
-
-                // Optimal solution for the problem at hand: Find the index of the minimum cost (in the costFunctionMatrix) for possible candidates
-                // Possible candidate: !coveredMatrix && assignmentMatrix
-                //((maskMatrix == condition) ? (A) : (B)).minCoeff
-                //((!coveredMatrix && assignmentMatrix) ? (costFunctionMatrix) : (dummyCost+1)).minCoeff
-                //(dummyCost+1) since costFunctionMatrix may contain the dummyCost
-                int idxRow, idxCol;
-                // Check if there are any possible candidates left
-                if (((!coveredMatrix.array()) && (assignmentMatrix.array())).any())
-                {
-                    // Assign the optimal candidate
-                    ((!coveredMatrix.array()) && (assignmentMatrix.array())).select((costFunctionMatrix.array()), (dummyCost + 1)).minCoeff(&idxRow, &idxCol);
-                }
-                // Else -> No possible candidates left, check uncovered elements
-                else
-                {
-                    (!coveredMatrix.array()).select((costFunctionMatrix.array()), (dummyCost + 1)).minCoeff(&idxRow, &idxCol);
-                }
-                // Clear all other possible assignments in the corresponding row and column
-                assignmentMatrix.row(idxRow).fill(false);
-                assignmentMatrix.col(idxCol).fill(false);
-                // Assign the element
-                assignmentMatrix(idxRow, idxCol) = true;
-
-                // Exclude row and column from future checking/assignments
-                coveredMatrix.row(idxRow).fill(true);
-                coveredMatrix.col(idxCol).fill(true);
-
-                // Check if the assignment is complete
-                if (coveredMatrix.all())
-                {
-                    return;
-                }
-
-                // Check the matrix again (iterate)
-            }
-        }
-    }
-}
-
-//--------------------Explicit class instantiation types--------------------//
-template class HungarianAlgorithm<int>;
-template class HungarianAlgorithm<float>;
-template class HungarianAlgorithm<double>;
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#include "HungarianAlgorithm.h"
+
+// Minimum number of lines of the Munkres steps to split them on the thread pool
+#define MIN_PARALLEL_LINES 256
+
+template <typename T>
+HungarianAlgorithm<T>::HungarianAlgorithm() {}
+
+template <typename T>
+HungarianAlgorithm<T>::HungarianAlgorithm(SolverStrategy strategy) : solverStrategy(strategy) {}
+
+template <class T>
+HungarianAlgorithm<T>::HungarianAlgorithm(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &costFcnMatrix, SolverStrategy strategy)
+    : solverStrategy(strategy)
+{
+    // Set cost function matrix
+    SetCostFunctionMatrix(costFcnMatrix);
+    // Update problemStatus
+    problemStatus = ProblemStatus::ReadyToSolve;
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::SetCostFunctionMatrix(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &costFcnMatrix)
+{
+    SetCostFunctionMatrix(costFcnMatrix.data(), (int)costFcnMatrix.rows(), (int)costFcnMatrix.cols(), 1, costFcnMatrix.rows());
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::SetCostFunctionMatrix(const T *costData, int nrRows, int nrCols, Eigen::Index rowStride, Eigen::Index colStride)
+{
+    CheckCosts(costData, nrRows, nrCols, rowStride, colStride);
+    // The buffer keeps its capacity, so problems up to the largest size so far are copied without allocation
+    bool isRowMajor = (std::abs(colStride) < std::abs(rowStride));
+    costBuffer.resize((size_t)nrRows * nrCols);
+    if ((isRowMajor && (colStride == 1) && (rowStride == nrCols)) || (!isRowMajor && (rowStride == 1) && (colStride == nrRows)))
+    {
+        std::copy(costData, costData + costBuffer.size(), costBuffer.begin());
+    }
+    else
+    {
+        // Copy line by line along the smaller stride
+        int nrLines = isRowMajor ? nrRows : nrCols;
+        int lineLength = isRowMajor ? nrCols : nrRows;
+        Eigen::Index lineStride = isRowMajor ? rowStride : colStride;
+        Eigen::Index elementStride = isRowMajor ? colStride : rowStride;
+        for (int line = 0; line < nrLines; line++)
+        {
+            for (int idx = 0; idx < lineLength; idx++)
+            {
+                costBuffer[(size_t)line * lineLength + idx] = costData[line * lineStride + idx * elementStride];
+            }
+        }
+    }
+    if (isRowMajor)
+    {
+        SetCostData(costBuffer.data(), nrRows, nrCols, nrCols, 1);
+    }
+    else
+    {
+        SetCostData(costBuffer.data(), nrRows, nrCols, 1, nrRows);
+    }
+    isCostView = false;
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::SetCostFunctionView(const T *costData, int nrRows, int nrCols, Eigen::Index rowStride, Eigen::Index colStride)
+{
+    CheckCosts(costData, nrRows, nrCols, rowStride, colStride);
+    SetCostData(costData, nrRows, nrCols, rowStride, colStride);
+    isCostView = true;
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::CheckCosts(const T *costData, int nrRows, int nrCols, Eigen::Index rowStride, Eigen::Index colStride) const
+{
+    if ((nrRows < 0) || (nrCols < 0))
+    {
+        throw std::invalid_argument("The cost function matrix dimensions cannot be negative!");
+    }
+    // Check if the costs contain any negative values (in the order of the memory)
+    bool isRowMajor = (std::abs(colStride) < std::abs(rowStride));
+    int nrLines = isRowMajor ? nrRows : nrCols;
+    int lineLength = isRowMajor ? nrCols : nrRows;
+    Eigen::Index lineStride = isRowMajor ? rowStride : colStride;
+    Eigen::Index elementStride = isRowMajor ? colStride : rowStride;
+    for (int line = 0; line < nrLines; line++)
+    {
+        for (int idx = 0; idx < lineLength; idx++)
+        {
+            T cost = costData[line * lineStride + idx * elementStride];
+            if (cost < 0)
+            {
+                throw std::invalid_argument("The cost function matrix cannot contain negative values!");
+            }
+            if (CostRange<T>::isLimited && (cost > CostRange<T>::GetMaxCost()))
+            {
+                throw std::invalid_argument("The cost function matrix cannot contain 64-bit integer costs above 2^53!");
+            }
+        }
+    }
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::SetCostData(const T *costData, int nrRows, int nrCols, Eigen::Index rowStride, Eigen::Index colStride)
+{
+    this->nrRows = nrRows;
+    this->nrCols = nrCols;
+    // All strategies work directly on the rectangular matrix
+    matrixSize = std::max(nrRows, nrCols);
+    ReleaseSparseProblem();
+    ReleaseCostFunction();
+    this->costData = costData;
+    costRowStride = rowStride;
+    costColStride = colStride;
+    // Solve on the transposed matrix if needed (nrRows <= nrCols), and for square matrices if the
+    // elements of a col are closer in memory than the elements of a row: each row of the solver
+    // is then contiguous in memory
+    solverTransposed = (nrRows > nrCols) || ((nrRows == nrCols) && (std::abs(rowStride) < std::abs(colStride)));
+    // The Munkres steps scan along the cols of their working matrix, which must be the smaller stride
+    munkresTransposed = (std::abs(colStride) < std::abs(rowStride));
+    munkresNrRows = munkresTransposed ? nrCols : nrRows;
+    munkresNrCols = munkresTransposed ? nrRows : nrCols;
+    munkresRowStride = munkresTransposed ? colStride : rowStride;
+    munkresColStride = munkresTransposed ? rowStride : colStride;
+    // A new problem cannot reuse a previous solution
+    warmStartPending = false;
+    // Update problemStatus
+    problemStatus = ProblemStatus::ReadyToSolve;
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::SetCostFunctionView(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &costFcnMatrix)
+{
+    SetCostFunctionView(costFcnMatrix.data(), (int)costFcnMatrix.rows(), (int)costFcnMatrix.cols(), 1, costFcnMatrix.rows());
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::ReleaseSparseProblem()
+{
+    if (isSparse)
+    {
+        isSparse = false;
+        sparseCostFunctionMatrix.resize(0, 0);
+        sparseCostFunctionMatrix.data().squeeze();
+        transposedSparseCostFunctionMatrix.resize(0, 0);
+        transposedSparseCostFunctionMatrix.data().squeeze();
+    }
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::ReleaseCostFunction()
+{
+    if (isCostFunction)
+    {
+        isCostFunction = false;
+        functionCostView.Release();
+    }
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::SetCostFunction(int nrRows, int nrCols, const CostFunction<T> &costFunction,
+                                            const CostRowBlockFunction<T> &rowBlockFunction, size_t maxCacheBytes)
+{
+    if ((nrRows < 0) || (nrCols < 0))
+    {
+        throw std::invalid_argument("The cost function matrix dimensions cannot be negative!");
+    }
+    if (!costFunction && (!rowBlockFunction || (nrRows > nrCols)))
+    {
+        throw std::invalid_argument("The cost function is undefined!");
+    }
+    this->nrRows = nrRows;
+    this->nrCols = nrCols;
+    matrixSize = std::max(nrRows, nrCols);
+    ReleaseSparseProblem();
+    isCostView = false;
+    costData = nullptr;
+    // The solver works on the transposed matrix if needed (nrRows <= nrCols), computing the costs col by col
+    solverTransposed = (nrRows > nrCols);
+    isCostFunction = true;
+    functionCostView.SetCostFunction(std::min(nrRows, nrCols), std::max(nrRows, nrCols), solverTransposed, costFunction,
+                                     rowBlockFunction, maxCacheBytes, COST_FUNCTION_BLOCK_ROWS);
+    warmStartPending = false;
+    problemStatus = ProblemStatus::ReadyToSolve;
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::SetCostFunctionMatrix(const Eigen::SparseMatrix<T> &costFcnMatrix)
+{
+    // Convert to row-major CSR, which gives direct access to the feasible cols of each row
+    Eigen::SparseMatrix<T, Eigen::RowMajor> rowMajorMatrix = costFcnMatrix;
+    rowMajorMatrix.makeCompressed();
+    SetCostFunctionMatrix((int)rowMajorMatrix.rows(), (int)rowMajorMatrix.cols(), rowMajorMatrix.outerIndexPtr(),
+                          rowMajorMatrix.innerIndexPtr(), rowMajorMatrix.valuePtr());
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::SetCostFunctionMatrix(int nrRows, int nrCols, const int *rowOffsets, const int *colIndices, const T *values)
+{
+    if ((nrRows < 0) || (nrCols < 0))
+    {
+        throw std::invalid_argument("The cost function matrix dimensions cannot be negative!");
+    }
+    // Check the CSR structure and values
+    int nrElements = rowOffsets[nrRows];
+    for (int row = 0; row < nrRows; row++)
+    {
+        if ((rowOffsets[0] != 0) || (rowOffsets[row + 1] < rowOffsets[row]))
+        {
+            throw std::invalid_argument("The row offsets of the cost function matrix must start at 0 and be non-decreasing!");
+        }
+    }
+    for (int idx = 0; idx < nrElements; idx++)
+    {
+        if ((colIndices[idx] < 0) || (colIndices[idx] >= nrCols))
+        {
+            throw std::invalid_argument("The col indices of the cost function matrix are out of range!");
+        }
+        if (values[idx] < 0)
+        {
+            throw std::invalid_argument("The cost function matrix cannot contain negative values!");
+        }
+        if (CostRange<T>::isLimited && (values[idx] > CostRange<T>::GetMaxCost()))
+        {
+            throw std::invalid_argument("The cost function matrix cannot contain 64-bit integer costs above 2^53!");
+        }
+    }
+
+    // Copy the sparse matrix
+    this->nrRows = nrRows;
+    this->nrCols = nrCols;
+    matrixSize = std::max(nrRows, nrCols);
+    sparseCostFunctionMatrix = Eigen::Map<const Eigen::SparseMatrix<T, Eigen::RowMajor>>(nrRows, nrCols, nrElements, rowOffsets, colIndices, values);
+    // More rows than cols are solved on the transposed matrix, which gives the potentials of the larger dimension to
+    // the cols of the solver (not positive and zero if unassigned)
+    if (nrRows > nrCols)
+    {
+        transposedSparseCostFunctionMatrix = sparseCostFunctionMatrix.transpose();
+    }
+    else
+    {
+        transposedSparseCostFunctionMatrix.resize(0, 0);
+        transposedSparseCostFunctionMatrix.data().squeeze();
+    }
+    isSparse = true;
+    ReleaseCostFunction();
+    // The dense matrices are not needed
+    isCostView = false;
+    costData = nullptr;
+    warmStartPending = false;
+    problemStatus = ProblemStatus::ReadyToSolve;
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::SetCostFunctionPoints(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &rowPoints,
+                                                  const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &colPoints, double maxDistance)
+{
+    // Only the pairs within the gate become elements of the sparse cost function matrix
+    geometricCandidates.Build(rowPoints, colPoints, maxDistance);
+    SetCostFunctionMatrix(geometricCandidates.GetNrRows(), geometricCandidates.GetNrCols(), geometricCandidates.GetRowOffsets(),
+                          geometricCandidates.GetColIndices(), geometricCandidates.GetCosts());
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::UpdateCostFunctionMatrix(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &costFcnMatrix)
+{
+    if (problemStatus < ProblemStatus::ReadyToSolve)
+    {
+        throw std::invalid_argument("The cost function matrix is undefined!");
+    }
+    if ((costFcnMatrix.rows() != nrRows) || (costFcnMatrix.cols() != nrCols))
+    {
+        throw std::invalid_argument("The input matrix dimensions is inconsistent with the cost function matrix!");
+    }
+    // Check if the input matrix contains any negative values
+    if ((costFcnMatrix.array() < 0).any())
+    {
+        throw std::invalid_argument("The cost function matrix cannot contain negative values!");
+    }
+    if (CostRange<T>::isLimited && (costFcnMatrix.array() > CostRange<T>::GetMaxCost()).any())
+    {
+        throw std::invalid_argument("The cost function matrix cannot contain 64-bit integer costs above 2^53!");
+    }
+    // Update only the changed elements
+    for (int col = 0; col < nrCols; col++)
+    {
+        for (int row = 0; row < nrRows; row++)
+        {
+            if (costFcnMatrix(row, col) != GetCost(row, col))
+            {
+                UpdateCostFunctionElement(row, col, costFcnMatrix(row, col));
+            }
+        }
+    }
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::UpdateCostFunctionElement(int row, int col, T cost)
+{
+    if (problemStatus < ProblemStatus::ReadyToSolve)
+    {
+        throw std::invalid_argument("The cost function matrix is undefined!");
+    }
+    if (isSparse)
+    {
+        throw std::invalid_argument("The elements of a sparse cost function matrix cannot be updated!");
+    }
+    if (isCostView || isCostFunction)
+    {
+        throw std::invalid_argument("The elements of a cost function view cannot be updated!");
+    }
+    if ((row < 0) || (row >= nrRows) || (col < 0) || (col >= nrCols))
+    {
+        throw std::invalid_argument("The element index is out of range of the cost function matrix!");
+    }
+    if (cost < 0)
+    {
+        throw std::invalid_argument("The cost function matrix cannot contain negative values!");
+    }
+    if (CostRange<T>::isLimited && (cost > CostRange<T>::GetMaxCost()))
+    {
+        throw std::invalid_argument("The cost function matrix cannot contain 64-bit integer costs above 2^53!");
+    }
+    // Only the augmenting path solver can continue from the previous solution, the other strategies start again
+    if ((solverStrategy == SolverStrategy::ShortestAugmentingPath) && augmentingPathSolver.HasSolution() && ((problemStatus == ProblemStatus::Done) || warmStartPending))
+    {
+        if (solverTransposed)
+        {
+            augmentingPathSolver.UpdateCost(col, row, GetCost(row, col), cost);
+        }
+        else
+        {
+            augmentingPathSolver.UpdateCost(row, col, GetCost(row, col), cost);
+        }
+        warmStartPending = true;
+    }
+    costBuffer[row * costRowStride + col * costColStride] = cost;
+    problemStatus = ProblemStatus::ReadyToSolve;
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::AddRow(const Eigen::Matrix<T, Eigen::Dynamic, 1> &rowCosts)
+{
+    ChangeLine(true, nrRows, rowCosts.data(), (int)rowCosts.size());
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::AddCol(const Eigen::Matrix<T, Eigen::Dynamic, 1> &colCosts)
+{
+    ChangeLine(false, nrCols, colCosts.data(), (int)colCosts.size());
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::RemoveRow(int row)
+{
+    ChangeLine(true, row, nullptr, 0);
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::RemoveCol(int col)
+{
+    ChangeLine(false, col, nullptr, 0);
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::ChangeLine(bool isRow, int line, const T *lineCosts, int nrLineCosts)
+{
+    if (problemStatus < ProblemStatus::ReadyToSolve)
+    {
+        throw std::invalid_argument("The cost function matrix is undefined!");
+    }
+    if (isSparse)
+    {
+        throw std::invalid_argument("The rows/cols of a sparse cost function matrix cannot be changed!");
+    }
+    if (isCostView || isCostFunction)
+    {
+        throw std::invalid_argument("The rows/cols of a cost function view cannot be changed!");
+    }
+    if (lineCosts != nullptr)
+    {
+        if (nrLineCosts != (isRow ? nrCols : nrRows))
+        {
+            throw std::invalid_argument("The number of costs is inconsistent with the cost function matrix!");
+        }
+        for (int idx = 0; idx < nrLineCosts; idx++)
+        {
+            if (lineCosts[idx] < 0)
+            {
+                throw std::invalid_argument("The cost function matrix cannot contain negative values!");
+            }
+            if (CostRange<T>::isLimited && (lineCosts[idx] > CostRange<T>::GetMaxCost()))
+            {
+                throw std::invalid_argument("The cost function matrix cannot contain 64-bit integer costs above 2^53!");
+            }
+        }
+    }
+    else if ((line < 0) || (line >= (isRow ? nrRows : nrCols)))
+    {
+        throw std::invalid_argument("The element index is out of range of the cost function matrix!");
+    }
+    // Only the augmenting path solver can continue from the previous solution, the other strategies start again
+    bool isWarmStart =
+        (solverStrategy == SolverStrategy::ShortestAugmentingPath) && augmentingPathSolver.HasSolution() && ((problemStatus == ProblemStatus::Done) || warmStartPending);
+    bool wasSolverTransposed = solverTransposed;
+
+    // Change the buffer in its layout: its lines are the rows of row-major costs and the cols otherwise. Whole lines
+    // are appended or erased, single elements of all lines are moved in place
+    bool isRowMajor = (std::abs(costColStride) < std::abs(costRowStride));
+    int nrLines = isRowMajor ? nrRows : nrCols;
+    int lineLength = isRowMajor ? nrCols : nrRows;
+    if ((isRow == isRowMajor) && (lineCosts != nullptr))
+    {
+        costBuffer.insert(costBuffer.end(), lineCosts, lineCosts + lineLength);
+    }
+    else if (isRow == isRowMajor)
+    {
+        costBuffer.erase(costBuffer.begin() + (size_t)line * lineLength, costBuffer.begin() + (size_t)(line + 1) * lineLength);
+    }
+    else if (lineCosts != nullptr)
+    {
+        costBuffer.resize((size_t)nrLines * (lineLength + 1));
+        for (int idx = nrLines - 1; idx >= 0; idx--)
+        {
+            if (idx > 0)
+            {
+                std::copy_backward(costBuffer.begin() + (size_t)idx * lineLength, costBuffer.begin() + (size_t)(idx + 1) * lineLength,
+                                   costBuffer.begin() + (size_t)idx * (lineLength + 1) + lineLength);
+            }
+            costBuffer[(size_t)idx * (lineLength + 1) + lineLength] = lineCosts[idx];
+        }
+    }
+    else
+    {
+        size_t nrCopied = 0;
+        for (int idx = 0; idx < nrLines; idx++)
+        {
+            for (int element = 0; element < lineLength; element++)
+            {
+                if (element != line)
+                {
+                    costBuffer[nrCopied++] = costBuffer[(size_t)idx * lineLength + element];
+                }
+            }
+        }
+        costBuffer.resize(nrCopied);
+    }
+    int newNrRows = nrRows + (isRow ? ((lineCosts != nullptr) ? 1 : -1) : 0);
+    int newNrCols = nrCols + (isRow ? 0 : ((lineCosts != nullptr) ? 1 : -1));
+    if (isRowMajor)
+    {
+        SetCostData(costBuffer.data(), newNrRows, newNrCols, newNrCols, 1);
+    }
+    else
+    {
+        SetCostData(costBuffer.data(), newNrRows, newNrCols, 1, newNrRows);
+    }
+    if (!isWarmStart)
+    {
+        return;
+    }
+
+    // Map the rows/cols to the previous problem, the solver lines are transposed if its orientation changed
+    std::vector<int> &changedOrigins = isRow ? rowOrigins : colOrigins;
+    std::vector<int> &keptOrigins = isRow ? colOrigins : rowOrigins;
+    changedOrigins.resize(isRow ? nrRows : nrCols);
+    for (int idx = 0; idx < (int)changedOrigins.size(); idx++)
+    {
+        changedOrigins[idx] = (lineCosts != nullptr) ? ((idx < line) ? idx : -1) : ((idx < line) ? idx : idx + 1);
+    }
+    keptOrigins.resize(isRow ? nrCols : nrRows);
+    for (int idx = 0; idx < (int)keptOrigins.size(); idx++)
+    {
+        keptOrigins[idx] = idx;
+    }
+    augmentingPathSolver.Resize(solverTransposed ? colOrigins : rowOrigins, solverTransposed ? rowOrigins : colOrigins,
+                                solverTransposed != wasSolverTransposed);
+    warmStartPending = true;
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::SetSolverStrategy(SolverStrategy strategy)
+{
+    if (solverStrategy == strategy)
+    {
+        return;
+    }
+    solverStrategy = strategy;
+    // A defined problem has to be solved again with the new strategy
+    problemStatus = std::min(problemStatus, ProblemStatus::ReadyToSolve);
+    warmStartPending = false;
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::SetNrOfThreads(int nrThreads)
+{
+    if (nrThreads < 0)
+    {
+        throw std::invalid_argument("The number of threads cannot be negative!");
+    }
+    // The thread pool is created again with the new size when needed
+    if (nrThreads != this->nrThreads)
+    {
+        threadPool.reset();
+    }
+    this->nrThreads = nrThreads;
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::GetCostFunctionMatrix(Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &outMatrix)
+{
+    if (problemStatus < ProblemStatus::ReadyToSolve)
+    {
+        throw std::invalid_argument("The cost function matrix is undefined!");
+    }
+    if (isSparse)
+    {
+        throw std::invalid_argument("A sparse cost function matrix cannot be copied to a dense matrix!");
+    }
+    if (isCostFunction)
+    {
+        // Compute all costs
+        outMatrix.resize(nrRows, nrCols);
+        VisitDenseCosts([&](int row, int col, T cost) { outMatrix(row, col) = cost; });
+        return;
+    }
+    // Copy cost function matrix to the output (without padding)
+    outMatrix = GetCostMap();
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::GetAssignmentMatrix(Eigen::Matrix<int, Eigen::Dynamic, Eigen::Dynamic> &outMatrix)
+{
+    if (problemStatus < ProblemStatus::Done)
+    {
+        throw std::invalid_argument("The assignment problem has not been solved yet!");
+    }
+    // Build the assignment matrix from the assigned col of each row
+    const int *assignedCols = GetAssignmentData(false);
+    outMatrix.resize(nrRows, nrCols);
+    outMatrix.setZero();
+    for (int row = 0; row < nrRows; row++)
+    {
+        if (assignedCols[row] >= 0)
+        {
+            outMatrix(row, assignedCols[row]) = 1;
+        }
+    }
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::GetAssignmentMatrix(Eigen::SparseMatrix<int> &outMatrix)
+{
+    if (problemStatus < ProblemStatus::Done)
+    {
+        throw std::invalid_argument("The assignment problem has not been solved yet!");
+    }
+    // Each col holds at most one element
+    const int *assignedRows = GetAssignmentData(true);
+    outMatrix.resize(nrRows, nrCols);
+    outMatrix.reserve(Eigen::VectorXi::Constant(nrCols, 1));
+    for (int col = 0; col < nrCols; col++)
+    {
+        if (assignedRows[col] >= 0)
+        {
+            outMatrix.insert(assignedRows[col], col) = 1;
+        }
+    }
+    outMatrix.makeCompressed();
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::GetAssignmentResults(std::vector<int> &rowIndices, std::vector<int> &colIndices)
+{
+    if (problemStatus < ProblemStatus::Done)
+    {
+        throw std::invalid_argument("The assignment problem has not been solved yet!");
+    }
+    // Vectors keep their capacity, so reusing them for problems of varying sizes does not allocate
+    const int *assignedCols = GetAssignmentData(false);
+    const int *assignedRows = GetAssignmentData(true);
+    rowIndices.assign(assignedCols, assignedCols + nrRows);
+    colIndices.assign(assignedRows, assignedRows + nrCols);
+}
+
+template <typename T>
+Eigen::Map<const Eigen::VectorXi> HungarianAlgorithm<T>::GetRowAssignment()
+{
+    if (problemStatus < ProblemStatus::Done)
+    {
+        throw std::invalid_argument("The assignment problem has not been solved yet!");
+    }
+    return Eigen::Map<const Eigen::VectorXi>(GetAssignmentData(false), nrRows);
+}
+
+template <typename T>
+Eigen::Map<const Eigen::VectorXi> HungarianAlgorithm<T>::GetColAssignment()
+{
+    if (problemStatus < ProblemStatus::Done)
+    {
+        throw std::invalid_argument("The assignment problem has not been solved yet!");
+    }
+    return Eigen::Map<const Eigen::VectorXi>(GetAssignmentData(true), nrCols);
+}
+
+template <typename T>
+const int *HungarianAlgorithm<T>::GetAssignmentData(bool ofCols)
+{
+    // The best assignments of an interrupted solve are completed outside of the solver
+    if (problemStatus == ProblemStatus::Interrupted)
+    {
+        return ofCols ? colAssignment.data() : rowAssignment.data();
+    }
+    // The assignments of sparse problems are copied after solving
+    if (isSparse || (GetActiveStrategy() == SolverStrategy::Munkres))
+    {
+        return ofCols ? colAssignment.data() : rowAssignment.data();
+    }
+    // The rows of the costs are the cols of the solver if it works on the transposed matrix
+    bool ofSolverCols = (ofCols != solverTransposed);
+    if (GetActiveStrategy() == SolverStrategy::Auction)
+    {
+        return ofSolverCols ? auctionSolver.GetColAssignment().data() : auctionSolver.GetRowAssignment().data();
+    }
+    return ofSolverCols ? augmentingPathSolver.GetColAssignment().data() : augmentingPathSolver.GetRowAssignment().data();
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::GetInfeasibleRows(std::vector<int> &infeasibleRows)
+{
+    if (problemStatus < ProblemStatus::Done)
+    {
+        throw std::invalid_argument("The assignment problem has not been solved yet!");
+    }
+    infeasibleRows.clear();
+    // Only the missing elements of sparse problems are infeasible
+    if (isSparse)
+    {
+        for (int row = 0; row < nrRows; row++)
+        {
+            if (rowAssignment[row] == -1)
+            {
+                infeasibleRows.push_back(row);
+            }
+        }
+    }
+}
+
+template <typename T>
+template <typename Visitor>
+void HungarianAlgorithm<T>::VisitDenseCosts(const Visitor &visitor)
+{
+    if (isCostFunction)
+    {
+        // Each row is computed once (with its block of rows) or taken from the cache
+        for (int solverRow = 0; solverRow < functionCostView.GetNrRows(); solverRow++)
+        {
+            Eigen::Index colStride;
+            const T *costRow = functionCostView.GetRow(solverRow, colStride);
+            for (int solverCol = 0; solverCol < functionCostView.GetNrCols(); solverCol++)
+            {
+                T cost = costRow[solverCol * colStride];
+                solverTransposed ? visitor(solverCol, solverRow, cost) : visitor(solverRow, solverCol, cost);
+            }
+        }
+        return;
+    }
+    for (int col = 0; col < nrCols; col++)
+    {
+        for (int row = 0; row < nrRows; row++)
+        {
+            visitor(row, col, GetCost(row, col));
+        }
+    }
+}
+
+template <typename T>
+T HungarianAlgorithm<T>::GetElementCost(int row, int col)
+{
+    if (isSparse)
+    {
+        return sparseCostFunctionMatrix.coeff(row, col);
+    }
+    if (isCostFunction)
+    {
+        return solverTransposed ? functionCostView.GetCost(col, row) : functionCostView.GetCost(row, col);
+    }
+    return GetCost(row, col);
+}
+
+template <typename T>
+double HungarianAlgorithm<T>::GetTotalCost()
+{
+    if (problemStatus < ProblemStatus::Done)
+    {
+        throw std::invalid_argument("The assignment problem has not been solved yet!");
+    }
+    double totalCost = 0;
+    for (int row = 0; row < nrRows; row++)
+    {
+        int col = GetAssignedCol(row);
+        if (col >= 0)
+        {
+            totalCost += (double)GetElementCost(row, col);
+        }
+    }
+    return totalCost;
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::GetDualPotentials(std::vector<double> &rowPotential, std::vector<double> &colPotential)
+{
+    if (problemStatus < ProblemStatus::Done)
+    {
+        throw std::invalid_argument("The assignment problem has not been solved yet!");
+    }
+    ComputeDualPotentials();
+    rowPotential.assign(dualRowPotential.begin(), dualRowPotential.end());
+    colPotential.assign(dualColPotential.begin(), dualColPotential.end());
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::ComputeDualPotentials()
+{
+    dualRowPotential.resize(nrRows);
+    dualColPotential.resize(nrCols);
+    if (isSparse)
+    {
+        // The potentials of the slack cols are not reported. The lines of the smaller dimension which cannot be
+        // assigned keep the potentials of their slack cols, zero potentials are also feasible for them (the costs are
+        // not negative and the potentials of the larger dimension are not positive) and add nothing to the total cost
+        bool isTransposed = (nrRows > nrCols);
+        for (int row = 0; row < nrRows; row++)
+        {
+            dualRowPotential[row] = isTransposed ? sparseSolver.GetColPotential(row) : sparseSolver.GetRowPotential(row);
+            if (!isTransposed && (rowAssignment[row] == -1))
+            {
+                dualRowPotential[row] = 0;
+            }
+        }
+        for (int col = 0; col < nrCols; col++)
+        {
+            dualColPotential[col] = isTransposed ? sparseSolver.GetRowPotential(col) : sparseSolver.GetColPotential(col);
+            if (isTransposed && (colAssignment[col] == -1))
+            {
+                dualColPotential[col] = 0;
+            }
+        }
+        return;
+    }
+    if (GetActiveStrategy() == SolverStrategy::Munkres)
+    {
+        // The Munkres steps work on the transposed matrix if munkresTransposed is set
+        const std::vector<double> &costRowReduction = munkresTransposed ? colReduction : rowReduction;
+        const std::vector<double> &costColReduction = munkresTransposed ? rowReduction : colReduction;
+        // The padded rows (or cols) of an optimal solution share one potential, moving it to the real cols (or
+        // rows) gives zero potentials to the lines assigned to padding
+        double shift = 0;
+        if (nrRows < nrCols)
+        {
+            shift = -costRowReduction[nrRows];
+        }
+        else if (nrRows > nrCols)
+        {
+            shift = costColReduction[nrCols];
+        }
+        for (int row = 0; row < nrRows; row++)
+        {
+            dualRowPotential[row] = costRowReduction[row] + shift;
+        }
+        for (int col = 0; col < nrCols; col++)
+        {
+            dualColPotential[col] = costColReduction[col] - shift;
+        }
+        return;
+    }
+
+    // The augmenting path and auction solvers work on the transposed matrix if solverTransposed is set
+    std::vector<double> &solverRowPotential = solverTransposed ? dualColPotential : dualRowPotential;
+    std::vector<double> &solverColPotential = solverTransposed ? dualRowPotential : dualColPotential;
+    if (GetActiveStrategy() == SolverStrategy::ShortestAugmentingPath)
+    {
+        solverRowPotential = augmentingPathSolver.GetRowPotential();
+        solverColPotential = augmentingPathSolver.GetColPotential();
+        return;
+    }
+    // Auction: the col potentials are the negative prices relative to the lowest price (the cols of the dummy rows
+    // have the lowest prices within epsilon), the assignments of the real rows are tight
+    auctionSolver.GetColPrices(solverColPotential);
+    double minPrice = solverColPotential.empty() ? 0 : *std::min_element(solverColPotential.begin(), solverColPotential.end());
+    for (double &potential : solverColPotential)
+    {
+        potential = minPrice - potential;
+    }
+    DenseCostMatrixView<T> costView = GetSolverCostView();
+    const std::vector<int> &solverRowAssignment = auctionSolver.GetRowAssignment();
+    for (int row = 0; row < (int)solverRowPotential.size(); row++)
+    {
+        int col = solverRowAssignment[row];
+        Eigen::Index colStride;
+        solverRowPotential[row] = (double)costView.GetRow(row, colStride)[col * colStride] - solverColPotential[col];
+    }
+}
+
+template <typename T>
+bool HungarianAlgorithm<T>::VerifyOptimality(double tolerance)
+{
+    if (problemStatus < ProblemStatus::Done)
+    {
+        throw std::invalid_argument("The assignment problem has not been solved yet!");
+    }
+    ComputeDualPotentials();
+
+    // The assignments must be a matching: each col is used by at most one row
+    verifiedColRow.assign(nrCols, -1);
+    int nrAssignedRows = 0;
+    for (int row = 0; row < nrRows; row++)
+    {
+        int col = GetAssignedCol(row);
+        if (col == -1)
+        {
+            continue;
+        }
+        if ((col < 0) || (col >= nrCols) || (verifiedColRow[col] != -1))
+        {
+            return false;
+        }
+        verifiedColRow[col] = row;
+        nrAssignedRows++;
+    }
+
+    // Dual feasibility (non-negative reduced costs) and complementary slackness (zero reduced costs of the assignments)
+    // are checked after the pass over all elements, which also finds the largest cost for the tolerance
+    double maxCost = 0, minReducedCost = 0, maxAssignedReducedCost = 0;
+    auto checkElement = [&](int row, int col, double cost) {
+        double reducedCost = cost - dualRowPotential[row] - dualColPotential[col];
+        maxCost = std::max(maxCost, cost);
+        minReducedCost = std::min(minReducedCost, reducedCost);
+        if (verifiedColRow[col] == row)
+        {
+            maxAssignedReducedCost = std::max(maxAssignedReducedCost, std::abs(reducedCost));
+        }
+    };
+    if (isSparse)
+    {
+        // Only the stored elements are feasible assignments
+        for (int row = 0; row < nrRows; row++)
+        {
+            for (typename Eigen::SparseMatrix<T, Eigen::RowMajor>::InnerIterator it(sparseCostFunctionMatrix, row); it; ++it)
+            {
+                checkElement(row, (int)it.col(), (double)it.value());
+            }
+        }
+    }
+    else
+    {
+        // All rows (or cols) of the smaller dimension must be assigned
+        if (nrAssignedRows != std::min(nrRows, nrCols))
+        {
+            return false;
+        }
+        VisitDenseCosts([&](int row, int col, T cost) { checkElement(row, col, (double)cost); });
+    }
+    // Absolute tolerance, relative to the largest cost
+    double absTolerance = tolerance * std::max(maxCost, 1.0);
+    if ((minReducedCost < -absTolerance) || (maxAssignedReducedCost > absTolerance))
+    {
+        return false;
+    }
+
+    // The potentials of the larger dimension cannot be positive, and are zero for the unassigned rows/cols (the cols
+    // of square sparse problems too, as the slack cols of the rows are their competitors)
+    if (nrRows > nrCols)
+    {
+        for (int row = 0; row < nrRows; row++)
+        {
+            double potential = dualRowPotential[row];
+            if ((potential > absTolerance) || ((GetAssignedCol(row) == -1) && (potential < -absTolerance)))
+            {
+                return false;
+            }
+        }
+    }
+    if ((nrCols > nrRows) || (isSparse && (nrCols == nrRows)))
+    {
+        for (int col = 0; col < nrCols; col++)
+        {
+            double potential = dualColPotential[col];
+            if ((potential > absTolerance) || ((verifiedColRow[col] == -1) && (potential < -absTolerance)))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <typename T>
+const SolveStatistics &HungarianAlgorithm<T>::SolveAssignmentProblem()
+{
+    return SolveAssignmentProblem(SolveBudget());
+}
+
+template <typename T>
+const SolveStatistics &HungarianAlgorithm<T>::SolveAssignmentProblem(const SolveBudget &budget)
+{
+    if (problemStatus < ProblemStatus::ReadyToSolve)
+    {
+        throw std::invalid_argument("The cost function matrix is undefined!");
+    }
+    // Only the augmenting path solver keeps a valid partial solution when it stops early
+    if (budget.IsLimited() && (isSparse || (GetActiveStrategy() != SolverStrategy::ShortestAugmentingPath)))
+    {
+        throw std::invalid_argument("A limited budget needs the ShortestAugmentingPath strategy and dense costs or a cost function!");
+    }
+    HUNGARIAN_STATS(statistics = SolveStatistics());
+    HUNGARIAN_STATS(statistics.isEnabled = true);
+    HUNGARIAN_STATS(size_t workspaceSize = GetWorkspaceSize());
+    {
+        HUNGARIAN_STATS(SolveStepTimer solveTimer(statistics, SolveStep::SolveAssignmentProblemStep, traceCallback));
+        if (isSparse)
+        {
+            HUNGARIAN_STATS(SolveStepTimer stepTimer(statistics, SolveStep::SparseShortestAugmentingPathStep, traceCallback));
+            HUNGARIAN_STATS(sparseSolver.SetStatistics(&statistics));
+            // The solver rows are the cols of the costs if there are more rows than cols
+            bool isTransposed = (nrRows > nrCols);
+            const Eigen::SparseMatrix<T, Eigen::RowMajor> &solverMatrix = isTransposed ? transposedSparseCostFunctionMatrix : sparseCostFunctionMatrix;
+            sparseSolver.Solve((int)solverMatrix.rows(), (int)solverMatrix.cols(), solverMatrix.outerIndexPtr(), solverMatrix.innerIndexPtr(),
+                               solverMatrix.valuePtr(), GetThreadPool());
+            std::vector<int> &solverRowAssignment = isTransposed ? colAssignment : rowAssignment;
+            std::vector<int> &solverColAssignment = isTransposed ? rowAssignment : colAssignment;
+            solverRowAssignment.resize(solverMatrix.rows());
+            for (int row = 0; row < (int)solverMatrix.rows(); row++)
+            {
+                solverRowAssignment[row] = sparseSolver.GetAssignedCol(row);
+            }
+            solverColAssignment.assign(sparseSolver.GetColAssignment().begin(), sparseSolver.GetColAssignment().begin() + solverMatrix.cols());
+            nrOfIterations = sparseSolver.GetNrOfScannedRows();
+        }
+        else if (GetActiveStrategy() == SolverStrategy::ShortestAugmentingPath)
+        {
+            HUNGARIAN_STATS(SolveStepTimer stepTimer(statistics, SolveStep::ShortestAugmentingPathStep, traceCallback));
+            HUNGARIAN_STATS(augmentingPathSolver.SetStatistics(&statistics));
+            augmentingPathSolver.SetBudget(budget);
+            SolveShortestAugmentingPath();
+            nrOfIterations = augmentingPathSolver.GetNrOfScannedRows();
+            warmStartPending = false;
+        }
+        else if (GetActiveStrategy() == SolverStrategy::Auction)
+        {
+            HUNGARIAN_STATS(SolveStepTimer stepTimer(statistics, SolveStep::AuctionStep, traceCallback));
+            SolveAuction();
+            nrOfIterations = auctionSolver.GetNrOfRounds();
+        }
+        else
+        {
+            SolveMunkres();
+        }
+    }
+    HUNGARIAN_STATS(statistics.nrOfIterations = nrOfIterations);
+    HUNGARIAN_STATS(statistics.nrOfBytesAllocated = (long long)GetWorkspaceSize() - (long long)workspaceSize);
+    // Assignment is done, unless the budget ran out
+    if ((GetActiveStrategy() == SolverStrategy::ShortestAugmentingPath) && !isSparse && augmentingPathSolver.IsInterrupted())
+    {
+        problemStatus = ProblemStatus::Interrupted;
+        return statistics;
+    }
+    problemStatus = ProblemStatus::Done;
+    optimalityGap = 0;
+    return statistics;
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::SolveMunkres()
+{
+    // Execute the Hungarian algorithm sequence, starting without reductions
+    rowReduction.assign(matrixSize, 0);
+    colReduction.assign(matrixSize, 0);
+    if (munkresNrRows >= munkresNrCols)
+    {
+        // Step 1
+        SubtractRowMinima();
+        // Step 2
+        SubtractColMinima();
+    }
+    else
+    {
+        // Reverse the order
+        // Step 2
+        SubtractColMinima();
+        // Step 1
+        SubtractRowMinima();
+    }
+    StarIndependentZeros();
+    nrOfIterations = 0;
+    // Step 3
+    while (MinNrOfLinesToCoverAllZeros() != matrixSize)
+    {
+        // Step 4
+        AugmentCostFunctionMatrix();
+        nrOfIterations++;
+    }
+    // Step 5
+    FindOptimalCost();
+}
+
+template <typename T>
+size_t HungarianAlgorithm<T>::GetWorkspaceSize() const
+{
+    return GetCapacityBytes(rowReduction, colReduction, coveredRows, coveredCols, starredCols, starredRows, primedCols,
+                            minUncoveredInRow, minUncoveredCol, rowAssignment, colAssignment, completedRowAssignment, completedColAssignment, rowOrigins, colOrigins) +
+           augmentingPathSolver.GetWorkspaceSize() + auctionSolver.GetWorkspaceSize() + sparseSolver.GetWorkspaceSize() +
+           geometricCandidates.GetWorkspaceSize();
+}
+
+template <typename T>
+double HungarianAlgorithm<T>::GetWorkingElement(int row, int col) const
+{
+    // The padded rows/cols of non-square matrices have zero costs
+    double cost = ((row < munkresNrRows) && (col < munkresNrCols)) ? (double)costData[row * munkresRowStride + col * munkresColStride] : 0;
+    return cost - rowReduction[row] - colReduction[col];
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::SubtractRowMinima()
+{
+    HUNGARIAN_STATS(SolveStepTimer stepTimer(statistics, SolveStep::SubtractRowMinimaStep, traceCallback));
+    // Subtract the minimum value in each row (the rows are independent). The cols are scanned in the outer loop, so
+    // the elements of each chunk of rows are contiguous in memory, and the minima are kept in minUncoveredInRow
+    // (computed again when the starred cols are covered)
+    minUncoveredInRow.assign(matrixSize, std::numeric_limits<double>::infinity());
+    ForEachLineChunk(matrixSize, [&](int firstRow, int endRow) {
+        for (int col = 0; col < matrixSize; col++)
+        {
+            for (int row = firstRow; row < endRow; row++)
+            {
+                minUncoveredInRow[row] = std::min(minUncoveredInRow[row], GetWorkingElement(row, col));
+            }
+        }
+        for (int row = firstRow; row < endRow; row++)
+        {
+            rowReduction[row] += minUncoveredInRow[row];
+        }
+    });
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::SubtractColMinima()
+{
+    HUNGARIAN_STATS(SolveStepTimer stepTimer(statistics, SolveStep::SubtractColMinimaStep, traceCallback));
+    // Subtract the minimum value in each column (the cols are independent)
+    ForEachLineChunk(matrixSize, [&](int firstCol, int endCol) {
+        for (int col = firstCol; col < endCol; col++)
+        {
+            double colMinCoeff = std::numeric_limits<double>::infinity();
+            for (int row = 0; row < matrixSize; row++)
+            {
+                colMinCoeff = std::min(colMinCoeff, GetWorkingElement(row, col));
+            }
+            colReduction[col] += colMinCoeff;
+        }
+    });
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::StarIndependentZeros()
+{
+    HUNGARIAN_STATS(SolveStepTimer stepTimer(statistics, SolveStep::StarIndependentZerosStep, traceCallback));
+    // Star the first zero of each row which has no starred zero in its col yet
+    starredCols.assign(matrixSize, -1);
+    starredRows.assign(matrixSize, -1);
+    for (int row = 0; row < matrixSize; row++)
+    {
+        for (int col = 0; col < matrixSize; col++)
+        {
+            if ((starredRows[col] == -1) && (GetWorkingElement(row, col) <= 0))
+            {
+                starredCols[row] = col;
+                starredRows[col] = row;
+                break;
+            }
+        }
+    }
+    CoverStarredCols();
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::CoverStarredCols()
+{
+    // Each starred zero is covered by its col
+    coveredRows.assign(matrixSize, false);
+    coveredCols.resize(matrixSize);
+    primedCols.assign(matrixSize, -1);
+    nrLinesToCoverZeroes = 0;
+    for (int col = 0; col < matrixSize; col++)
+    {
+        coveredCols[col] = (starredRows[col] != -1);
+        nrLinesToCoverZeroes += coveredCols[col];
+    }
+    if (nrLinesToCoverZeroes == matrixSize)
+    {
+        return;
+    }
+
+    // Find the minimum of each row over the uncovered cols (on chunks of rows, each row sees the cols in order)
+    minUncoveredInRow.assign(matrixSize, std::numeric_limits<double>::infinity());
+    minUncoveredCol.assign(matrixSize, -1);
+    ForEachLineChunk(matrixSize, [&](int firstRow, int endRow) {
+        for (int col = 0; col < matrixSize; col++)
+        {
+            if (!coveredCols[col])
+            {
+                for (int row = firstRow; row < endRow; row++)
+                {
+                    double value = GetWorkingElement(row, col);
+                    if (value < minUncoveredInRow[row])
+                    {
+                        minUncoveredInRow[row] = value;
+                        minUncoveredCol[row] = col;
+                    }
+                }
+            }
+        }
+    });
+}
+
+template <typename T>
+int HungarianAlgorithm<T>::MinNrOfLinesToCoverAllZeros()
+{
+    HUNGARIAN_STATS(SolveStepTimer stepTimer(statistics, SolveStep::MinNrOfLinesToCoverAllZerosStep, traceCallback));
+    // Each starred zero needs its own line, the cover is complete when all rows have a starred zero
+    while (nrLinesToCoverZeroes < matrixSize)
+    {
+        // Find an uncovered zero (the minimum of an uncovered row is zero)
+        int row = 0;
+        while ((row < matrixSize) && (coveredRows[row] || (minUncoveredInRow[row] > 0)))
+        {
+            row++;
+        }
+        if (row == matrixSize)
+        {
+            // All zeroes are covered with fewer lines than needed -> Create additional zeroes
+            return (nrLinesToCoverZeroes);
+        }
+
+        // Prime the zero
+        int col = minUncoveredCol[row];
+        primedCols[row] = col;
+        HUNGARIAN_STATS(statistics.nrOfCoveredZeros++);
+        int starredCol = starredCols[row];
+        if (starredCol != -1)
+        {
+            // Cover the row and uncover the col of the starred zero instead (same number of lines)
+            coveredRows[row] = true;
+            coveredCols[starredCol] = false;
+            // The uncovered col may contain smaller values for the uncovered rows
+            for (int idxRow = 0; idxRow < matrixSize; idxRow++)
+            {
+                if (!coveredRows[idxRow])
+                {
+                    double value = GetWorkingElement(idxRow, starredCol);
+                    if (value < minUncoveredInRow[idxRow])
+                    {
+                        minUncoveredInRow[idxRow] = value;
+                        minUncoveredCol[idxRow] = starredCol;
+                    }
+                }
+            }
+        }
+        else
+        {
+            // No starred zero in the row -> One more starred zero along the alternating path, start a new cover
+            FlipStarredZeros(row);
+            CoverStarredCols();
+        }
+    }
+    // return the total number of lines needed to cover the zeroes in the working matrix
+    return (nrLinesToCoverZeroes);
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::FlipStarredZeros(int row)
+{
+    // Alternate between the primed zero of a row and the starred zero in its col
+    HUNGARIAN_STATS(int pathLength = 0);
+    while (row != -1)
+    {
+        int col = primedCols[row];
+        int nextRow = starredRows[col];
+        starredCols[row] = col;
+        starredRows[col] = row;
+        row = nextRow;
+        HUNGARIAN_STATS(pathLength++);
+    }
+    HUNGARIAN_STATS(statistics.AddAugmentingPath(pathLength));
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::AugmentCostFunctionMatrix()
+{
+    HUNGARIAN_STATS(SolveStepTimer stepTimer(statistics, SolveStep::AugmentCostFunctionMatrixStep, traceCallback));
+    // Masked operations on all rows/cols at once
+    Eigen::Map<Eigen::ArrayXd> rowReductionArray(rowReduction.data(), matrixSize);
+    Eigen::Map<Eigen::ArrayXd> colReductionArray(colReduction.data(), matrixSize);
+    Eigen::Map<Eigen::ArrayXd> minUncoveredArray(minUncoveredInRow.data(), matrixSize);
+    auto isRowCovered = Eigen::Map<const Eigen::Array<char, Eigen::Dynamic, 1>>(coveredRows.data(), matrixSize) != 0;
+    auto isColCovered = Eigen::Map<const Eigen::Array<char, Eigen::Dynamic, 1>>(coveredCols.data(), matrixSize) != 0;
+
+    // Find the minimum value of the uncovered elements
+    double minUncoveredCoeff = isRowCovered.select(std::numeric_limits<double>::infinity(), minUncoveredArray).minCoeff();
+
+    // Add the minimum value to the covered rows and subtract it from the uncovered cols: the uncovered
+    // elements decrease, and the elements at the intersection of two lines increase
+    rowReductionArray = isRowCovered.select(rowReductionArray - minUncoveredCoeff, rowReductionArray);
+    colReductionArray = isColCovered.select(colReductionArray, colReductionArray + minUncoveredCoeff);
+    minUncoveredArray = isRowCovered.select(minUncoveredArray, minUncoveredArray - minUncoveredCoeff);
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::FindOptimalCost()
+{
+    HUNGARIAN_STATS(SolveStepTimer stepTimer(statistics, SolveStep::FindOptimalCostStep, traceCallback));
+    // The starred zeroes form the optimal assignment, the padded rows/cols are unassigned (the rows of the costs
+    // are the cols of the Munkres steps if they work on the transposed matrix)
+    const std::vector<int> &assignedCols = munkresTransposed ? starredRows : starredCols;
+    const std::vector<int> &assignedRows = munkresTransposed ? starredCols : starredRows;
+    rowAssignment.resize(nrRows);
+    colAssignment.resize(nrCols);
+    for (int row = 0; row < nrRows; row++)
+    {
+        rowAssignment[row] = (assignedCols[row] < nrCols) ? assignedCols[row] : -1;
+    }
+    for (int col = 0; col < nrCols; col++)
+    {
+        colAssignment[col] = (assignedRows[col] < nrRows) ? assignedRows[col] : -1;
+    }
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::SolveShortestAugmentingPath()
+{
+    // An interrupted solve of the unchanged problem is continued
+    bool isResumed = (problemStatus == ProblemStatus::Interrupted);
+    augmentingPathSolver.SetThreadPool(GetThreadPool());
+    if (isCostFunction)
+    {
+        if (isResumed)
+        {
+            augmentingPathSolver.Continue(functionCostView);
+        }
+        else
+        {
+            augmentingPathSolver.Solve(functionCostView);
+        }
+        UpdateInterruptedSolution(functionCostView);
+        return;
+    }
+    DenseCostMatrixView<T> costView = GetSolverCostView();
+    if (isResumed)
+    {
+        augmentingPathSolver.Continue(costView);
+    }
+    else if (warmStartPending)
+    {
+        // Repair the previous solution after cost updates
+        augmentingPathSolver.Resolve(costView);
+    }
+    else
+    {
+        augmentingPathSolver.Solve(costView);
+    }
+    UpdateInterruptedSolution(costView);
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::UpdateInterruptedSolution(CostMatrixView<T> &costView)
+{
+    if (!augmentingPathSolver.IsInterrupted())
+    {
+        return;
+    }
+    double lowerBound;
+    double totalCost = augmentingPathSolver.CompleteAssignment(costView, completedRowAssignment, completedColAssignment, lowerBound);
+    // Both bounds hold for all partial solutions of the problem, but the greedy completion of a later one can be worse
+    bool isResumed = (problemStatus == ProblemStatus::Interrupted);
+    interruptedLowerBound = isResumed ? std::max(interruptedLowerBound, lowerBound) : lowerBound;
+    if (!isResumed || (totalCost < interruptedTotalCost))
+    {
+        // Report the assignments in the orientation of the cost function matrix
+        rowAssignment.assign(solverTransposed ? completedColAssignment.begin() : completedRowAssignment.begin(),
+                             solverTransposed ? completedColAssignment.end() : completedRowAssignment.end());
+        colAssignment.assign(solverTransposed ? completedRowAssignment.begin() : completedColAssignment.begin(),
+                             solverTransposed ? completedRowAssignment.end() : completedColAssignment.end());
+        interruptedTotalCost = totalCost;
+    }
+    optimalityGap = std::max(interruptedTotalCost - interruptedLowerBound, 0.0);
+}
+
+template <typename T>
+void HungarianAlgorithm<T>::SolveAuction()
+{
+    DenseCostMatrixView<T> costView = GetSolverCostView();
+    // Compute the bids on the thread pool if more than one thread is used
+    auctionSolver.Solve(costView, GetThreadPool());
+}
+
+template <typename T>
+ThreadPool *HungarianAlgorithm<T>::GetThreadPool()
+{
+    if (nrThreads == 1)
+    {
+        return nullptr;
+    }
+    if (!threadPool)
+    {
+        threadPool = std::make_shared<ThreadPool>(nrThreads);
+    }
+    return threadPool.get();
+}
+
+template <typename T>
+template <typename Function>
+void HungarianAlgorithm<T>::ForEachLineChunk(int nrLines, const Function &processLines)
+{
+    // Each line costs O(matrixSize), so small problems are not worth the synchronization
+    ThreadPool *pool = (nrLines >= MIN_PARALLEL_LINES) ? GetThreadPool() : nullptr;
+    if (pool == nullptr)
+    {
+        processLines(0, nrLines);
+        return;
+    }
+    int nrChunks = pool->GetNrThreads();
+    pool->ParallelFor(nrChunks, [&](int idxChunk, int) {
+        processLines((int)((long long)nrLines * idxChunk / nrChunks), (int)((long long)nrLines * (idxChunk + 1) / nrChunks));
+    });
+}
+
+template <typename T>
+DenseCostMatrixView<T> HungarianAlgorithm<T>::GetSolverCostView()
+{
+    // View the costs as a matrix with nrRows <= nrCols, transposed if needed
+    if (solverTransposed)
+    {
+        return DenseCostMatrixView<T>(costData, nrCols, nrRows, costColStride, costRowStride);
+    }
+    return DenseCostMatrixView<T>(costData, nrRows, nrCols, costRowStride, costColStride);
+}
+
+template <typename T>
+Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>, 0, Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>> HungarianAlgorithm<T>::GetCostMap() const
+{
+    return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>, 0, Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>>(
+        costData, nrRows, nrCols, Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>(costColStride, costRowStride));
+}
+
+//--------------------Explicit class instantiation types--------------------//
+template class HungarianAlgorithm<int16_t>;
+template class HungarianAlgorithm<uint16_t>;
+template class HungarianAlgorithm<int>;
+template class HungarianAlgorithm<int64_t>;
+template class HungarianAlgorithm<float>;
+template class HungarianAlgorithm<double>;
 //--------------------------------------------------------------------------//
\ No newline at end of file
@@ -0,0 +1,141 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#include "HungarianBatchSolver.h"
+
+template <typename T>
+HungarianBatchSolver<T>::HungarianBatchSolver(int nrThreads) : threadPool(nrThreads)
+{
+    threadSolvers.resize(threadPool.GetNrThreads());
+}
+
+template <typename T>
+int HungarianBatchSolver<T>::AddCostFunctionMatrix(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &costFcnMatrix)
+{
+    // Append the matrix to the packed costs
+    packedCosts.insert(packedCosts.end(), costFcnMatrix.data(), costFcnMatrix.data() + costFcnMatrix.size());
+    problemRows.push_back((int)costFcnMatrix.rows());
+    problemCols.push_back((int)costFcnMatrix.cols());
+    return GetNrOfProblems() - 1;
+}
+
+template <typename T>
+void HungarianBatchSolver<T>::Clear()
+{
+    packedCosts.clear();
+    problemRows.clear();
+    problemCols.clear();
+}
+
+template <typename T>
+void HungarianBatchSolver<T>::SolveAssignmentProblems()
+{
+    SolveAssignmentProblems(packedCosts.data(), problemRows.data(), problemCols.data(), GetNrOfProblems());
+}
+
+template <typename T>
+void HungarianBatchSolver<T>::SolveAssignmentProblems(const T *packedCostFcnMatrices, const int *nrRows, const int *nrCols, int nrProblems)
+{
+    // Find the position of each problem in the packed costs and in the results
+    costOffsets.resize(nrProblems);
+    resultOffsets.resize(nrProblems + 1);
+    solvedRows.assign(nrRows, nrRows + nrProblems);
+    size_t costOffset = 0;
+    resultOffsets[0] = 0;
+    for (int problemIdx = 0; problemIdx < nrProblems; problemIdx++)
+    {
+        if ((nrRows[problemIdx] < 0) || (nrCols[problemIdx] < 0))
+        {
+            throw std::invalid_argument("The cost function matrix dimensions cannot be negative!");
+        }
+        costOffsets[problemIdx] = costOffset;
+        costOffset += (size_t)nrRows[problemIdx] * nrCols[problemIdx];
+        resultOffsets[problemIdx + 1] = resultOffsets[problemIdx] + nrRows[problemIdx] + nrCols[problemIdx];
+    }
+    // Check if the input matrices contain any negative values (before starting any thread)
+    if ((Eigen::Map<const Eigen::Array<T, Eigen::Dynamic, 1>>(packedCostFcnMatrices, costOffset) < 0).any())
+    {
+        throw std::invalid_argument("The cost function matrix cannot contain negative values!");
+    }
+    if (CostRange<T>::isLimited && (Eigen::Map<const Eigen::Array<T, Eigen::Dynamic, 1>>(packedCostFcnMatrices, costOffset) > CostRange<T>::GetMaxCost()).any())
+    {
+        throw std::invalid_argument("The cost function matrix cannot contain 64-bit integer costs above 2^53!");
+    }
+    assignmentResults.resize(resultOffsets[nrProblems]);
+
+    // Solve the problems on all threads
+    threadPool.ParallelFor(nrProblems, [&](int problemIdx, int threadIdx) {
+        SolveProblem(packedCostFcnMatrices + costOffsets[problemIdx], nrRows[problemIdx], nrCols[problemIdx],
+                     assignmentResults.data() + resultOffsets[problemIdx], threadIdx);
+    });
+}
+
+template <typename T>
+void HungarianBatchSolver<T>::SolveProblem(const T *costs, int nrRows, int nrCols, int *results, int threadIdx)
+{
+    AugmentingPathSolver<T> &solver = threadSolvers[threadIdx];
+    int *rowIndices = results;
+    int *colIndices = results + nrRows;
+    // The solver needs nrRows <= nrCols, solve on the transposed matrix otherwise
+    if (nrRows <= nrCols)
+    {
+        DenseCostMatrixView<T> costView(costs, nrRows, nrCols, 1, nrRows);
+        solver.Solve(costView);
+        std::copy(solver.GetRowAssignment().begin(), solver.GetRowAssignment().end(), rowIndices);
+        std::copy(solver.GetColAssignment().begin(), solver.GetColAssignment().end(), colIndices);
+    }
+    else
+    {
+        DenseCostMatrixView<T> costView(costs, nrCols, nrRows, nrRows, 1);
+        solver.Solve(costView);
+        std::copy(solver.GetRowAssignment().begin(), solver.GetRowAssignment().end(), colIndices);
+        std::copy(solver.GetColAssignment().begin(), solver.GetColAssignment().end(), rowIndices);
+    }
+}
+
+template <typename T>
+void HungarianBatchSolver<T>::GetAssignmentResults(int problemIdx, std::vector<int> &rowIndices, std::vector<int> &colIndices)
+{
+    if ((problemIdx < 0) || (problemIdx + 1 >= (int)resultOffsets.size()))
+    {
+        throw std::invalid_argument("The problem index is out of range of the solved batch!");
+    }
+    const int *results = assignmentResults.data() + resultOffsets[problemIdx];
+    int nrRows = solvedRows[problemIdx];
+    int nrCols = (int)(resultOffsets[problemIdx + 1] - resultOffsets[problemIdx]) - nrRows;
+    // Vectors keep their capacity, so reusing them for problems of varying sizes does not allocate
+    rowIndices.assign(results, results + nrRows);
+    colIndices.assign(results + nrRows, results + nrRows + nrCols);
+}
+
+//--------------------Explicit class instantiation types--------------------//
+template class HungarianBatchSolver<int16_t>;
+template class HungarianBatchSolver<uint16_t>;
+template class HungarianBatchSolver<int>;
+template class HungarianBatchSolver<int64_t>;
+template class HungarianBatchSolver<float>;
+template class HungarianBatchSolver<double>;
+//--------------------------------------------------------------------------//
@@ -0,0 +1,238 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#include "HungarianSolverService.h"
+#include <algorithm>
+
+template <typename T>
+HungarianSolverService<T>::HungarianSolverService(int nrThreads, int maxQueueSize, SolverStrategy strategy)
+    : stopping(false), totalQueueTimeMs(0), totalLatencyMs(0)
+{
+    if (maxQueueSize <= 0)
+    {
+        throw std::invalid_argument("The maximum queue size must be positive!");
+    }
+    this->maxQueueSize = (size_t)maxQueueSize;
+    if (nrThreads <= 0)
+    {
+        nrThreads = std::max(1, (int)std::thread::hardware_concurrency());
+    }
+    // Each worker reuses its own solver for all its problems
+    for (int workerIdx = 0; workerIdx < nrThreads; workerIdx++)
+    {
+        solvers.emplace_back(new HungarianAlgorithm<T>(strategy));
+    }
+    for (int workerIdx = 0; workerIdx < nrThreads; workerIdx++)
+    {
+        workers.emplace_back(&HungarianSolverService<T>::WorkerLoop, this, workerIdx);
+    }
+}
+
+template <typename T>
+HungarianSolverService<T>::~HungarianSolverService()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    queueNotEmpty.notify_all();
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+template <typename T>
+std::future<AssignmentResult> HungarianSolverService<T>::Submit(Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> costFcnMatrix)
+{
+    Request request;
+    request.costFcnMatrix.swap(costFcnMatrix);
+    std::future<AssignmentResult> future = request.promise.get_future();
+    Enqueue(request, true);
+    return future;
+}
+
+template <typename T>
+void HungarianSolverService<T>::Submit(Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> costFcnMatrix, const AssignmentCallback &callback)
+{
+    if (!callback)
+    {
+        throw std::invalid_argument("The callback of the results is undefined!");
+    }
+    Request request;
+    request.costFcnMatrix.swap(costFcnMatrix);
+    request.callback = callback;
+    Enqueue(request, true);
+}
+
+template <typename T>
+bool HungarianSolverService<T>::TrySubmit(Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> costFcnMatrix, std::future<AssignmentResult> &future)
+{
+    Request request;
+    request.costFcnMatrix.swap(costFcnMatrix);
+    std::future<AssignmentResult> requestFuture = request.promise.get_future();
+    if (!Enqueue(request, false))
+    {
+        return false;
+    }
+    future = std::move(requestFuture);
+    return true;
+}
+
+template <typename T>
+bool HungarianSolverService<T>::Enqueue(Request &request, bool waitForSpace)
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (queue.size() >= maxQueueSize)
+        {
+            if (!waitForSpace)
+            {
+                metrics.nrRejected++;
+                return false;
+            }
+            // Back-pressure: the caller waits until a worker takes a problem from the queue
+            queueNotFull.wait(lock, [this]() { return queue.size() < maxQueueSize; });
+        }
+        request.submitTime = std::chrono::steady_clock::now();
+        queue.push_back(std::move(request));
+        metrics.nrSubmitted++;
+        metrics.queueDepth = (int)queue.size();
+        metrics.maxQueueDepth = std::max(metrics.maxQueueDepth, metrics.queueDepth);
+    }
+    queueNotEmpty.notify_one();
+    return true;
+}
+
+template <typename T>
+void HungarianSolverService<T>::WorkerLoop(int workerIdx)
+{
+    HungarianAlgorithm<T> &solver = *solvers[workerIdx];
+    while (true)
+    {
+        // Take the oldest problem (the queue is emptied before stopping)
+        Request request;
+        double queueTimeMs;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            queueNotEmpty.wait(lock, [this]() { return stopping || !queue.empty(); });
+            if (queue.empty())
+            {
+                return;
+            }
+            request = std::move(queue.front());
+            queue.pop_front();
+            metrics.queueDepth = (int)queue.size();
+            metrics.nrActive++;
+            queueTimeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - request.submitTime).count();
+        }
+        queueNotFull.notify_one();
+
+        AssignmentResult result;
+        std::exception_ptr error;
+        try
+        {
+            solver.SetCostFunctionMatrix(request.costFcnMatrix);
+            solver.SolveAssignmentProblem();
+            solver.GetAssignmentResults(result.rowIndices, result.colIndices);
+            result.totalCost = solver.GetTotalCost();
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        // The metrics are updated before the results are delivered, the problem stays active until its result is delivered
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            double latencyMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - request.submitTime).count();
+            metrics.nrCompleted++;
+            metrics.nrFailed += (error != nullptr);
+            totalQueueTimeMs += queueTimeMs;
+            totalLatencyMs += latencyMs;
+            metrics.maxQueueTimeMs = std::max(metrics.maxQueueTimeMs, queueTimeMs);
+            metrics.maxLatencyMs = std::max(metrics.maxLatencyMs, latencyMs);
+        }
+        if (request.callback)
+        {
+            // Exceptions of the callback cannot be reported to the caller
+            try
+            {
+                request.callback(result, error);
+            }
+            catch (...)
+            {
+            }
+        }
+        else if (error)
+        {
+            request.promise.set_exception(error);
+        }
+        else
+        {
+            request.promise.set_value(std::move(result));
+        }
+
+        // Wake the callers waiting for an idle service
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            metrics.nrActive--;
+            if (queue.empty() && (metrics.nrActive == 0))
+            {
+                serviceIdle.notify_all();
+            }
+        }
+    }
+}
+
+template <typename T>
+void HungarianSolverService<T>::WaitUntilIdle()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    serviceIdle.wait(lock, [this]() { return queue.empty() && (metrics.nrActive == 0); });
+}
+
+template <typename T>
+SolverServiceMetrics HungarianSolverService<T>::GetMetrics()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    SolverServiceMetrics snapshot = metrics;
+    if (metrics.nrCompleted > 0)
+    {
+        snapshot.meanQueueTimeMs = totalQueueTimeMs / metrics.nrCompleted;
+        snapshot.meanLatencyMs = totalLatencyMs / metrics.nrCompleted;
+    }
+    return snapshot;
+}
+
+//--------------------Explicit class instantiation types--------------------//
+template class HungarianSolverService<int16_t>;
+template class HungarianSolverService<uint16_t>;
+template class HungarianSolverService<int>;
+template class HungarianSolverService<int64_t>;
+template class HungarianSolverService<float>;
+template class HungarianSolverService<double>;
+//--------------------------------------------------------------------------//
@@ -0,0 +1,340 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#include "KBestAssignmentSolver.h"
+#include <map>
+
+// Cost of the forbidden elements, no assignment can use them
+static const double forbiddenCost = std::numeric_limits<double>::infinity();
+
+template <typename T>
+KBestAssignmentSolver<T>::ConstrainedCostMatrixView::ConstrainedCostMatrixView(const DenseCostMatrixView<T> &costView)
+    : costView(costView), forcedColOfRow(costView.GetNrRows(), -1), forcedRowOfCol(costView.GetNrCols(), -1),
+      forbiddenMask((size_t)costView.GetNrRows() * costView.GetNrCols(), false), rowCosts(costView.GetNrCols())
+{
+}
+
+template <typename T>
+void KBestAssignmentSolver<T>::ConstrainedCostMatrixView::SetConstraints(const std::vector<std::pair<int, int>> &forcedElements,
+                                                                         const std::vector<std::pair<int, int>> &forbiddenElements)
+{
+    // Remove the constraints of the previous sub-problem
+    for (const auto &element : maskedElements)
+    {
+        forbiddenMask[(size_t)element.first * GetNrCols() + element.second] = false;
+    }
+    std::fill(forcedColOfRow.begin(), forcedColOfRow.end(), -1);
+    std::fill(forcedRowOfCol.begin(), forcedRowOfCol.end(), -1);
+
+    for (const auto &element : forcedElements)
+    {
+        forcedColOfRow[element.first] = element.second;
+        forcedRowOfCol[element.second] = element.first;
+    }
+    maskedElements.assign(forbiddenElements.begin(), forbiddenElements.end());
+    for (const auto &element : forbiddenElements)
+    {
+        forbiddenMask[(size_t)element.first * GetNrCols() + element.second] = true;
+    }
+}
+
+template <typename T>
+bool KBestAssignmentSolver<T>::ConstrainedCostMatrixView::IsAllowed(int row, int col) const
+{
+    if (forbiddenMask[(size_t)row * GetNrCols() + col])
+    {
+        return false;
+    }
+    // A forced row/col cannot be assigned to any other col/row
+    if (forcedColOfRow[row] != -1)
+    {
+        return forcedColOfRow[row] == col;
+    }
+    return (forcedRowOfCol[col] == -1) || (forcedRowOfCol[col] == row);
+}
+
+template <typename T>
+double KBestAssignmentSolver<T>::ConstrainedCostMatrixView::GetCost(int row, int col)
+{
+    Eigen::Index colStride;
+    return costView.GetRow(row, colStride)[col * colStride];
+}
+
+template <typename T>
+const double *KBestAssignmentSolver<T>::ConstrainedCostMatrixView::GetRow(int row, Eigen::Index &outColStride)
+{
+    Eigen::Index colStride;
+    const T *costRow = costView.GetRow(row, colStride);
+    for (int col = 0; col < GetNrCols(); col++)
+    {
+        rowCosts[col] = IsAllowed(row, col) ? (double)costRow[col * colStride] : forbiddenCost;
+    }
+    outColStride = 1;
+    return rowCosts.data();
+}
+
+template <typename T>
+KBestAssignmentSolver<T>::KBestAssignmentSolver(int nrThreads)
+    : nrRows(0), nrCols(0), solverTransposed(false), nrOfSolvedProblems(0), nrOfPrunedProblems(0), threadPool(nrThreads)
+{
+    threadWorkspaces.resize(threadPool.GetNrThreads());
+}
+
+template <typename T>
+void KBestAssignmentSolver<T>::SetCostFunctionMatrix(const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &costFcnMatrix)
+{
+    // Check if the input matrix contains any negative values
+    if ((costFcnMatrix.array() < 0).any())
+    {
+        throw std::invalid_argument("The cost function matrix cannot contain negative values!");
+    }
+    if (CostRange<T>::isLimited && (costFcnMatrix.array() > CostRange<T>::GetMaxCost()).any())
+    {
+        throw std::invalid_argument("The cost function matrix cannot contain 64-bit integer costs above 2^53!");
+    }
+    if (std::numeric_limits<T>::has_infinity && (costFcnMatrix.array() == std::numeric_limits<T>::infinity()).any())
+    {
+        throw std::invalid_argument("The cost function matrix cannot contain infinite costs!");
+    }
+    nrRows = (int)costFcnMatrix.rows();
+    nrCols = (int)costFcnMatrix.cols();
+    costs.assign(costFcnMatrix.data(), costFcnMatrix.data() + costFcnMatrix.size());
+    solverTransposed = (nrRows > nrCols);
+    // The views of the threads are created for the new costs
+    for (ThreadWorkspace &workspace : threadWorkspaces)
+    {
+        workspace.costView.reset(new ConstrainedCostMatrixView(GetSolverCostView()));
+    }
+    solutions.clear();
+    solutionCosts.clear();
+}
+
+template <typename T>
+DenseCostMatrixView<T> KBestAssignmentSolver<T>::GetSolverCostView() const
+{
+    if (solverTransposed)
+    {
+        return DenseCostMatrixView<T>(costs.data(), nrCols, nrRows, nrRows, 1);
+    }
+    return DenseCostMatrixView<T>(costs.data(), nrRows, nrCols, 1, nrRows);
+}
+
+template <typename T>
+int KBestAssignmentSolver<T>::SolveKBestAssignments(int k)
+{
+    if (threadWorkspaces[0].costView == nullptr)
+    {
+        throw std::invalid_argument("The cost function matrix is undefined!");
+    }
+    solutions.clear();
+    solutionCosts.clear();
+    nrOfSolvedProblems = 0;
+    nrOfPrunedProblems = 0;
+    if (k <= 0)
+    {
+        return 0;
+    }
+
+    // The optimal solution of the full problem is the root of the partition
+    ThreadWorkspace &rootWorkspace = threadWorkspaces[0];
+    rootWorkspace.costView->SetConstraints({}, {});
+    rootWorkspace.solver.Solve(*rootWorkspace.costView);
+    nrOfSolvedProblems++;
+    std::unique_ptr<Node> root(new Node());
+    root->rowAssignment = rootWorkspace.solver.GetRowAssignment();
+    root->rowPotential = rootWorkspace.solver.GetRowPotential();
+    root->colPotential = rootWorkspace.solver.GetColPotential();
+    root->cost = 0;
+    for (int row = 0; row < (int)root->rowAssignment.size(); row++)
+    {
+        root->cost += rootWorkspace.costView->GetCost(row, root->rowAssignment[row]);
+    }
+    root->sequence = 0;
+    long long sequence = 1;
+
+    // Queue of the solved sub-problems ordered by cost, only the best ones which can still be reported are kept
+    std::map<std::pair<double, long long>, std::unique_ptr<Node>> queue;
+    queue[std::make_pair(root->cost, root->sequence)] = std::move(root);
+    std::vector<int> freeRows;
+    std::vector<std::unique_ptr<Node>> children;
+    while (!queue.empty())
+    {
+        // The best queued sub-problem gives the next assignment
+        std::unique_ptr<Node> node = std::move(queue.begin()->second);
+        queue.erase(queue.begin());
+        solutions.push_back(node->rowAssignment);
+        solutionCosts.push_back(node->cost);
+        size_t nrOfMissingSolutions = (size_t)k - solutions.size();
+        if (nrOfMissingSolutions == 0)
+        {
+            break;
+        }
+
+        // Children which cannot beat the worst queued solution are not needed if the queue is full
+        while (queue.size() > nrOfMissingSolutions)
+        {
+            queue.erase(std::prev(queue.end()));
+        }
+        double threshold = (queue.size() == nrOfMissingSolutions) ? std::prev(queue.end())->first.first : std::numeric_limits<double>::infinity();
+
+        // Partition the sub-problem by the assignments of its free rows
+        freeRows.clear();
+        std::vector<char> isRowForced(node->rowAssignment.size(), false);
+        for (const auto &element : node->forcedElements)
+        {
+            isRowForced[element.first] = true;
+        }
+        for (int row = 0; row < (int)node->rowAssignment.size(); row++)
+        {
+            if (!isRowForced[row])
+            {
+                freeRows.push_back(row);
+            }
+        }
+        children.clear();
+        children.resize(freeRows.size());
+        threadPool.ParallelFor((int)freeRows.size(), [&](int idxChild, int threadIdx) {
+            children[idxChild] = SolveChild(*node, freeRows, idxChild, threshold, threadWorkspaces[threadIdx]);
+        });
+
+        // Queue the children in their order, which keeps the results independent of the threads
+        for (std::unique_ptr<Node> &child : children)
+        {
+            if (child == nullptr)
+            {
+                nrOfPrunedProblems++;
+                continue;
+            }
+            nrOfSolvedProblems++;
+            child->sequence = sequence++;
+            if ((queue.size() < nrOfMissingSolutions) || (child->cost < std::prev(queue.end())->first.first))
+            {
+                queue[std::make_pair(child->cost, child->sequence)] = std::move(child);
+                if (queue.size() > nrOfMissingSolutions)
+                {
+                    queue.erase(std::prev(queue.end()));
+                }
+            }
+        }
+    }
+    return GetNrOfSolutions();
+}
+
+template <typename T>
+std::unique_ptr<typename KBestAssignmentSolver<T>::Node> KBestAssignmentSolver<T>::SolveChild(const Node &parent, const std::vector<int> &freeRows, int idxChild,
+                                                                                               double threshold, ThreadWorkspace &workspace)
+{
+    // Keep the assignments of the previous free rows and forbid the assignment of the row
+    int row = freeRows[idxChild];
+    int col = parent.rowAssignment[row];
+    std::unique_ptr<Node> child(new Node());
+    child->forcedElements = parent.forcedElements;
+    for (int idx = 0; idx < idxChild; idx++)
+    {
+        child->forcedElements.push_back(std::make_pair(freeRows[idx], parent.rowAssignment[freeRows[idx]]));
+    }
+    child->forbiddenElements = parent.forbiddenElements;
+    child->forbiddenElements.push_back(std::make_pair(row, col));
+    ConstrainedCostMatrixView &costView = *workspace.costView;
+    costView.SetConstraints(child->forcedElements, child->forbiddenElements);
+
+    // Lower bound: the parent potentials stay feasible, and the row needs an element with a positive reduced cost
+    Eigen::Index colStride;
+    const double *costRow = costView.GetRow(row, colStride);
+    double minReducedCost = std::numeric_limits<double>::infinity();
+    for (int idxCol = 0; idxCol < costView.GetNrCols(); idxCol++)
+    {
+        if (costView.IsAllowed(row, idxCol))
+        {
+            minReducedCost = std::min(minReducedCost, (double)costRow[idxCol] - parent.rowPotential[row] - parent.colPotential[idxCol]);
+        }
+    }
+    if (parent.cost + minReducedCost >= threshold)
+    {
+        // Also the case for rows without allowed cols
+        return nullptr;
+    }
+
+    // Release the row from the parent solution and assign it again
+    AugmentingPathSolver<double> &solver = workspace.solver;
+    solver.SetSolution(parent.rowAssignment, parent.rowPotential, parent.colPotential);
+    solver.UpdateCost(row, col, costView.GetCost(row, col), forbiddenCost);
+    if (!solver.Resolve(costView))
+    {
+        return nullptr;
+    }
+    child->rowAssignment = solver.GetRowAssignment();
+    child->cost = 0;
+    for (int idxRow = 0; idxRow < (int)child->rowAssignment.size(); idxRow++)
+    {
+        // The solution can only use forbidden elements if the child has no feasible assignment
+        if (!costView.IsAllowed(idxRow, child->rowAssignment[idxRow]))
+        {
+            return nullptr;
+        }
+        child->cost += costView.GetCost(idxRow, child->rowAssignment[idxRow]);
+    }
+    child->rowPotential = solver.GetRowPotential();
+    child->colPotential = solver.GetColPotential();
+    return child;
+}
+
+template <typename T>
+double KBestAssignmentSolver<T>::GetTotalCost(int solutionIdx) const
+{
+    if ((solutionIdx < 0) || (solutionIdx >= GetNrOfSolutions()))
+    {
+        throw std::invalid_argument("The solution index is out of range of the found assignments!");
+    }
+    return solutionCosts[solutionIdx];
+}
+
+template <typename T>
+void KBestAssignmentSolver<T>::GetAssignmentResults(int solutionIdx, std::vector<int> &rowIndices, std::vector<int> &colIndices) const
+{
+    if ((solutionIdx < 0) || (solutionIdx >= GetNrOfSolutions()))
+    {
+        throw std::invalid_argument("The solution index is out of range of the found assignments!");
+    }
+    // The rows of the solver are the cols of the cost function matrix if it is transposed
+    std::vector<int> &solverRowIndices = solverTransposed ? colIndices : rowIndices;
+    std::vector<int> &solverColIndices = solverTransposed ? rowIndices : colIndices;
+    solverRowIndices = solutions[solutionIdx];
+    solverColIndices.assign(solverTransposed ? nrRows : nrCols, -1);
+    for (int row = 0; row < (int)solverRowIndices.size(); row++)
+    {
+        solverColIndices[solverRowIndices[row]] = row;
+    }
+}
+
+//--------------------Explicit class instantiation types--------------------//
+template class KBestAssignmentSolver<int16_t>;
+template class KBestAssignmentSolver<uint16_t>;
+template class KBestAssignmentSolver<int>;
+template class KBestAssignmentSolver<int64_t>;
+template class KBestAssignmentSolver<float>;
+template class KBestAssignmentSolver<double>;
+//--------------------------------------------------------------------------//
@@ -0,0 +1,67 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#include "SolveStatistics.h"
+
+void ChromeTraceRecorder::Record(const TraceEvent &event)
+{
+    std::lock_guard<std::mutex> lock(eventsMutex);
+    events.push_back(event);
+}
+
+TraceCallback ChromeTraceRecorder::GetCallback()
+{
+    return [this](const TraceEvent &event) { Record(event); };
+}
+
+size_t ChromeTraceRecorder::GetNrOfEvents() const
+{
+    std::lock_guard<std::mutex> lock(eventsMutex);
+    return events.size();
+}
+
+void ChromeTraceRecorder::Clear()
+{
+    std::lock_guard<std::mutex> lock(eventsMutex);
+    events.clear();
+}
+
+void ChromeTraceRecorder::WriteJson(std::ostream &stream) const
+{
+    std::lock_guard<std::mutex> lock(eventsMutex);
+    // Complete events ("X") with timestamps and durations in microseconds
+    std::ios::fmtflags flags = stream.flags();
+    stream << std::fixed << "{\"traceEvents\":[";
+    for (size_t idx = 0; idx < events.size(); idx++)
+    {
+        const TraceEvent &event = events[idx];
+        stream << ((idx == 0) ? "\n" : ",\n")
+               << "{\"name\":\"" << event.name << "\",\"cat\":\"HungarianAlgorithm\",\"ph\":\"X\",\"ts\":" << event.startTime
+               << ",\"dur\":" << event.duration << ",\"pid\":0,\"tid\":" << event.threadId << "}";
+    }
+    stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    stream.flags(flags);
+}
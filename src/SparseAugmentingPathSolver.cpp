@@ -0,0 +1,199 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#include "SparseAugmentingPathSolver.h"
+
+template <typename T>
+SparseAugmentingPathSolver<T>::SparseAugmentingPathSolver() : nrRows(0), nrCols(0), slackCost(1), minPathCost(0), nrOfScannedRows(0), statistics(nullptr) {}
+
+template <typename T>
+void SparseAugmentingPathSolver<T>::Solve(int nrRows, int nrCols, const int *rowOffsets, const int *colIndices, const T *values)
+{
+    this->nrRows = nrRows;
+    this->nrCols = nrCols;
+
+    // The slack cost must exceed the sum of the largest allowed cost of each row
+    slackCost = 1;
+    for (int row = 0; row < nrRows; row++)
+    {
+        if (rowOffsets[row + 1] > rowOffsets[row])
+        {
+            slackCost += (double)*std::max_element(values + rowOffsets[row], values + rowOffsets[row + 1]);
+        }
+    }
+
+    // Start from zero potentials, which are feasible for non-negative costs
+    int nrAllCols = nrCols + nrRows;
+    rowPotential.assign(nrRows, 0);
+    colPotential.assign(nrAllCols, 0);
+    rowAssignment.assign(nrRows, -1);
+    colAssignment.assign(nrAllCols, -1);
+    shortestPathCosts.assign(nrAllCols, std::numeric_limits<double>::infinity());
+    pathRow.resize(nrAllCols);
+    visitedCols.assign(nrAllCols, false);
+    reachedCols.clear();
+    nrOfScannedRows = 0;
+
+    // Assign the rows one after the other (a path to the slack col always exists)
+    for (int row = 0; row < nrRows; row++)
+    {
+        int sinkCol = FindShortestAugmentingPath(rowOffsets, colIndices, values, row);
+        AugmentPath(row, sinkCol);
+    }
+}
+
+template <typename T>
+int SparseAugmentingPathSolver<T>::GetNrOfUnassignedRows() const
+{
+    int nrUnassignedRows = 0;
+    for (int row = 0; row < nrRows; row++)
+    {
+        nrUnassignedRows += (rowAssignment[row] >= nrCols);
+    }
+    return nrUnassignedRows;
+}
+
+template <typename T>
+void SparseAugmentingPathSolver<T>::RelaxCol(int row, int col, double cost)
+{
+    if (visitedCols[col])
+    {
+        return;
+    }
+    double reducedCost = minPathCost + cost - rowPotential[row] - colPotential[col];
+    if (reducedCost < shortestPathCosts[col])
+    {
+        if (shortestPathCosts[col] == std::numeric_limits<double>::infinity())
+        {
+            reachedCols.push_back(col);
+        }
+        shortestPathCosts[col] = reducedCost;
+        pathRow[col] = row;
+        HeapEntry entry = {reducedCost, colAssignment[col] != -1, col};
+        heap.push_back(entry);
+        std::push_heap(heap.begin(), heap.end());
+    }
+}
+
+template <typename T>
+int SparseAugmentingPathSolver<T>::FindShortestAugmentingPath(const int *rowOffsets, const int *colIndices, const T *values, int startRow)
+{
+    // Reset only the cols reached by the previous search
+    for (int col : reachedCols)
+    {
+        shortestPathCosts[col] = std::numeric_limits<double>::infinity();
+        visitedCols[col] = false;
+    }
+    reachedCols.clear();
+    visitedRows.clear();
+    heap.clear();
+
+    // Grow the tree (Dijkstra) until a free col is reached
+    minPathCost = 0;
+    int row = startRow;
+    while (true)
+    {
+        visitedRows.push_back(row);
+        nrOfScannedRows++;
+        // Relax the allowed cols of the row and its slack col
+        for (int idx = rowOffsets[row]; idx < rowOffsets[row + 1]; idx++)
+        {
+            RelaxCol(row, colIndices[idx], (double)values[idx]);
+        }
+        RelaxCol(row, nrCols + row, slackCost);
+
+        // Take the closest col which was not visited yet (outdated heap entries are skipped)
+        HeapEntry closest;
+        do
+        {
+            closest = heap.front();
+            std::pop_heap(heap.begin(), heap.end());
+            heap.pop_back();
+        } while (visitedCols[closest.col] || (closest.cost != shortestPathCosts[closest.col]));
+
+        // Add the col to the tree and continue from its assigned row
+        minPathCost = closest.cost;
+        visitedCols[closest.col] = true;
+        if (colAssignment[closest.col] == -1)
+        {
+            return closest.col;
+        }
+        row = colAssignment[closest.col];
+    }
+}
+
+template <typename T>
+void SparseAugmentingPathSolver<T>::AugmentPath(int startRow, int sinkCol)
+{
+    // Update the dual potentials of the rows and cols in the tree
+    rowPotential[startRow] += minPathCost;
+    for (int row : visitedRows)
+    {
+        if (row != startRow)
+        {
+            rowPotential[row] += minPathCost - shortestPathCosts[rowAssignment[row]];
+        }
+    }
+    for (int col : reachedCols)
+    {
+        if (visitedCols[col])
+        {
+            colPotential[col] -= minPathCost - shortestPathCosts[col];
+        }
+    }
+
+    // Flip the assignments along the path, going back from the sink col to the start row
+    int col = sinkCol;
+    HUNGARIAN_STATS(int pathLength = 0);
+    while (true)
+    {
+        int row = pathRow[col];
+        colAssignment[col] = row;
+        std::swap(rowAssignment[row], col);
+        HUNGARIAN_STATS(pathLength++);
+        if (row == startRow)
+        {
+            break;
+        }
+    }
+    HUNGARIAN_STATS(if (statistics) statistics->AddAugmentingPath(pathLength));
+}
+
+template <typename T>
+size_t SparseAugmentingPathSolver<T>::GetWorkspaceSize() const
+{
+    return GetCapacityBytes(rowPotential, colPotential, rowAssignment, colAssignment, shortestPathCosts, pathRow, visitedCols,
+                            reachedCols, visitedRows, heap);
+}
+
+//--------------------Explicit class instantiation types--------------------//
+template class SparseAugmentingPathSolver<int16_t>;
+template class SparseAugmentingPathSolver<uint16_t>;
+template class SparseAugmentingPathSolver<int>;
+template class SparseAugmentingPathSolver<int64_t>;
+template class SparseAugmentingPathSolver<float>;
+template class SparseAugmentingPathSolver<double>;
+//--------------------------------------------------------------------------//
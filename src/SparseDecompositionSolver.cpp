@@ -0,0 +1,270 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#include "SparseDecompositionSolver.h"
+
+template <typename T>
+void SparseDecompositionSolver<T>::Solve(int nrRows, int nrCols, const int *rowOffsets, const int *colIndices, const T *values, ThreadPool *threadPool)
+{
+    this->nrRows = nrRows;
+    this->nrCols = nrCols;
+    rowAssignment.assign(nrRows, -1);
+    colAssignment.assign(nrCols, -1);
+    rowPotential.assign(nrRows, 0);
+    colPotential.assign(nrCols, 0);
+    nrOfForcedAssignments = 0;
+    nrOfScannedRows = 0;
+    workspaces.resize((threadPool != nullptr) ? threadPool->GetNrThreads() : 1);
+
+    if (!isDecompositionEnabled || (threadPool == nullptr) || (threadPool->GetNrThreads() == 1))
+    {
+        // Solve the whole problem in place (the searches of a single thread only visit the component of their row anyway)
+        SparseAugmentingPathSolver<T> &solver = workspaces[0].solver;
+        HUNGARIAN_STATS(solver.SetStatistics(statistics));
+        solver.Solve(nrRows, nrCols, rowOffsets, colIndices, values);
+        for (int row = 0; row < nrRows; row++)
+        {
+            rowAssignment[row] = solver.GetAssignedCol(row);
+            rowPotential[row] = solver.GetRowPotential(row);
+        }
+        for (int col = 0; col < nrCols; col++)
+        {
+            colAssignment[col] = solver.GetAssignedRow(col);
+            colPotential[col] = solver.GetColPotential(col);
+        }
+        nrOfComponents = 1;
+        nrOfScannedRows = solver.GetNrOfScannedRows();
+        HUNGARIAN_STATS(solver.SetStatistics(nullptr));
+        return;
+    }
+
+    FindComponents(rowOffsets, colIndices);
+    // Components with a single row or col are assigned directly, empty rows/cols stay unassigned
+    solvedComponents.clear();
+    for (int component = 0; component < nrOfComponents; component++)
+    {
+        int nrComponentRows = componentRowOffsets[component + 1] - componentRowOffsets[component];
+        int nrComponentCols = componentColOffsets[component + 1] - componentColOffsets[component];
+        if ((nrComponentRows == 1) || (nrComponentCols == 1))
+        {
+            if (componentElements[component] > 0)
+            {
+                AssignForcedComponent(component, rowOffsets, colIndices, values);
+            }
+        }
+        else if ((nrComponentRows > 0) && (nrComponentCols > 0))
+        {
+            solvedComponents.push_back(component);
+        }
+    }
+
+    // Solve the largest components first to balance the threads
+    std::sort(solvedComponents.begin(), solvedComponents.end(), [this](int component, int otherComponent) {
+        return (componentElements[component] > componentElements[otherComponent]) ||
+               ((componentElements[component] == componentElements[otherComponent]) && (component < otherComponent));
+    });
+    // The components do not share any rows/cols, so their results are written independently
+    componentScannedRows.assign(solvedComponents.size(), 0);
+    threadPool->ParallelFor((int)solvedComponents.size(), [&](int idx, int threadIdx) {
+        SolveComponent(solvedComponents[idx], rowOffsets, colIndices, values, workspaces[threadIdx]);
+        componentScannedRows[idx] = workspaces[threadIdx].solver.GetNrOfScannedRows();
+    });
+    for (long long nrOfComponentScannedRows : componentScannedRows)
+    {
+        nrOfScannedRows += nrOfComponentScannedRows;
+    }
+}
+
+template <typename T>
+int SparseDecompositionSolver<T>::FindRoot(int node)
+{
+    while (parentNodes[node] != node)
+    {
+        parentNodes[node] = parentNodes[parentNodes[node]];
+        node = parentNodes[node];
+    }
+    return node;
+}
+
+template <typename T>
+void SparseDecompositionSolver<T>::FindComponents(const int *rowOffsets, const int *colIndices)
+{
+    // Join each row with its feasible cols (col nodes follow the row nodes)
+    int nrNodes = nrRows + nrCols;
+    parentNodes.resize(nrNodes);
+    for (int node = 0; node < nrNodes; node++)
+    {
+        parentNodes[node] = node;
+    }
+    for (int row = 0; row < nrRows; row++)
+    {
+        for (int idx = rowOffsets[row]; idx < rowOffsets[row + 1]; idx++)
+        {
+            int rowRoot = FindRoot(row), colRoot = FindRoot(nrRows + colIndices[idx]);
+            if (rowRoot != colRoot)
+            {
+                // The smaller root becomes the parent, so the components are numbered by their first node
+                parentNodes[std::max(rowRoot, colRoot)] = std::min(rowRoot, colRoot);
+            }
+        }
+    }
+
+    // Number the components in the order of their first node
+    nodeComponents.resize(nrNodes);
+    nrOfComponents = 0;
+    for (int node = 0; node < nrNodes; node++)
+    {
+        int root = FindRoot(node);
+        nodeComponents[node] = (root == node) ? nrOfComponents++ : nodeComponents[root];
+    }
+
+    // Group the rows and cols by component (counting sort, which keeps their order within a component)
+    componentRowOffsets.assign(nrOfComponents + 1, 0);
+    componentColOffsets.assign(nrOfComponents + 1, 0);
+    componentElements.assign(nrOfComponents, 0);
+    for (int row = 0; row < nrRows; row++)
+    {
+        componentRowOffsets[nodeComponents[row] + 1]++;
+        componentElements[nodeComponents[row]] += rowOffsets[row + 1] - rowOffsets[row];
+    }
+    for (int col = 0; col < nrCols; col++)
+    {
+        componentColOffsets[nodeComponents[nrRows + col] + 1]++;
+    }
+    for (int component = 0; component < nrOfComponents; component++)
+    {
+        componentRowOffsets[component + 1] += componentRowOffsets[component];
+        componentColOffsets[component + 1] += componentColOffsets[component];
+    }
+    componentRows.resize(nrRows);
+    componentCols.resize(nrCols);
+    localCols.resize(nrCols);
+    // The offsets of the next row/col of each component are taken from parentNodes, which is not needed anymore
+    std::vector<int> &nextRowIdx = parentNodes;
+    std::copy(componentRowOffsets.begin(), componentRowOffsets.end() - 1, nextRowIdx.begin());
+    for (int row = 0; row < nrRows; row++)
+    {
+        componentRows[nextRowIdx[nodeComponents[row]]++] = row;
+    }
+    std::vector<int> &nextColIdx = parentNodes;
+    std::copy(componentColOffsets.begin(), componentColOffsets.end() - 1, nextColIdx.begin());
+    for (int col = 0; col < nrCols; col++)
+    {
+        int component = nodeComponents[nrRows + col];
+        localCols[col] = nextColIdx[component] - componentColOffsets[component];
+        componentCols[nextColIdx[component]++] = col;
+    }
+}
+
+template <typename T>
+void SparseDecompositionSolver<T>::AssignForcedComponent(int component, const int *rowOffsets, const int *colIndices, const T *values)
+{
+    // Find the cheapest element of the component (the first one for equal costs)
+    int bestRow = -1, bestCol = -1;
+    double bestCost = 0;
+    for (int idxRow = componentRowOffsets[component]; idxRow < componentRowOffsets[component + 1]; idxRow++)
+    {
+        int row = componentRows[idxRow];
+        for (int idx = rowOffsets[row]; idx < rowOffsets[row + 1]; idx++)
+        {
+            if ((bestRow == -1) || ((double)values[idx] < bestCost))
+            {
+                bestRow = row;
+                bestCol = colIndices[idx];
+                bestCost = (double)values[idx];
+            }
+        }
+    }
+    rowAssignment[bestRow] = bestCol;
+    colAssignment[bestCol] = bestRow;
+    nrOfForcedAssignments++;
+    // The potential of each row is the cheapest cost of the component, the col potentials stay zero: all reduced
+    // costs are non-negative, and zero for the assignment
+    for (int idxRow = componentRowOffsets[component]; idxRow < componentRowOffsets[component + 1]; idxRow++)
+    {
+        rowPotential[componentRows[idxRow]] = bestCost;
+    }
+}
+
+template <typename T>
+void SparseDecompositionSolver<T>::SolveComponent(int component, const int *rowOffsets, const int *colIndices, const T *values,
+                                                  ComponentWorkspace &workspace)
+{
+    // Copy the elements of the component with local col indices
+    int firstRowIdx = componentRowOffsets[component], nrComponentRows = componentRowOffsets[component + 1] - firstRowIdx;
+    int firstColIdx = componentColOffsets[component], nrComponentCols = componentColOffsets[component + 1] - firstColIdx;
+    workspace.rowOffsets.resize(nrComponentRows + 1);
+    workspace.colIndices.resize(componentElements[component]);
+    workspace.values.resize(componentElements[component]);
+    workspace.rowOffsets[0] = 0;
+    for (int localRow = 0; localRow < nrComponentRows; localRow++)
+    {
+        int row = componentRows[firstRowIdx + localRow], localIdx = workspace.rowOffsets[localRow];
+        for (int idx = rowOffsets[row]; idx < rowOffsets[row + 1]; idx++, localIdx++)
+        {
+            workspace.colIndices[localIdx] = localCols[colIndices[idx]];
+            workspace.values[localIdx] = values[idx];
+        }
+        workspace.rowOffsets[localRow + 1] = localIdx;
+    }
+
+    SparseAugmentingPathSolver<T> &solver = workspace.solver;
+    solver.Solve(nrComponentRows, nrComponentCols, workspace.rowOffsets.data(), workspace.colIndices.data(), workspace.values.data());
+    for (int localRow = 0; localRow < nrComponentRows; localRow++)
+    {
+        int row = componentRows[firstRowIdx + localRow], localCol = solver.GetAssignedCol(localRow);
+        rowAssignment[row] = (localCol >= 0) ? componentCols[firstColIdx + localCol] : -1;
+        rowPotential[row] = solver.GetRowPotential(localRow);
+    }
+    for (int localCol = 0; localCol < nrComponentCols; localCol++)
+    {
+        int col = componentCols[firstColIdx + localCol], localRow = solver.GetAssignedRow(localCol);
+        colAssignment[col] = (localRow >= 0) ? componentRows[firstRowIdx + localRow] : -1;
+        colPotential[col] = solver.GetColPotential(localCol);
+    }
+}
+
+template <typename T>
+size_t SparseDecompositionSolver<T>::GetWorkspaceSize() const
+{
+    size_t workspaceSize = GetCapacityBytes(parentNodes, nodeComponents, componentRowOffsets, componentRows, componentColOffsets, componentCols,
+                                            componentElements, solvedComponents, localCols, componentScannedRows, rowAssignment, colAssignment,
+                                            rowPotential, colPotential);
+    for (const ComponentWorkspace &workspace : workspaces)
+    {
+        workspaceSize += workspace.solver.GetWorkspaceSize() + GetCapacityBytes(workspace.rowOffsets, workspace.colIndices, workspace.values);
+    }
+    return workspaceSize;
+}
+
+//--------------------Explicit class instantiation types--------------------//
+template class SparseDecompositionSolver<int16_t>;
+template class SparseDecompositionSolver<uint16_t>;
+template class SparseDecompositionSolver<int>;
+template class SparseDecompositionSolver<int64_t>;
+template class SparseDecompositionSolver<float>;
+template class SparseDecompositionSolver<double>;
+//--------------------------------------------------------------------------//
@@ -0,0 +1,179 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#include "ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+
+// Time for which the threads poll for the next loop (or its completion) before sleeping
+#define SPIN_WAIT_MICROSECONDS 50
+
+// Poll the condition for a short time, returns false if it is still not met
+template <typename Condition>
+static bool SpinWait(const Condition &isMet)
+{
+    auto endTime = std::chrono::steady_clock::now() + std::chrono::microseconds(SPIN_WAIT_MICROSECONDS);
+    for (int idx = 1;; idx++)
+    {
+        if (isMet())
+        {
+            return true;
+        }
+        // Checking the time is more expensive than the condition
+        if (((idx % 64) == 0) && (std::chrono::steady_clock::now() > endTime))
+        {
+            return false;
+        }
+        std::this_thread::yield();
+    }
+}
+
+ThreadPool::ThreadPool(int nrThreads)
+    : task(nullptr), nrTasks(0), nextTask(0), nrBusyWorkers(0), generation(0), stopping(false), nrSleepingWorkers(0), isCallerWaiting(false)
+{
+    if (nrThreads <= 0)
+    {
+        nrThreads = std::max(1, (int)std::thread::hardware_concurrency());
+    }
+    // The calling thread is the first thread of the pool
+    for (int threadIdx = 1; threadIdx < nrThreads; threadIdx++)
+    {
+        workers.emplace_back(&ThreadPool::WorkerLoop, this, threadIdx);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    taskCondition.notify_all();
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+void ThreadPool::ParallelFor(int nrTasks, const std::function<void(int, int)> &task)
+{
+    // Run small loops directly on the calling thread
+    if (workers.empty() || (nrTasks <= 1))
+    {
+        for (int idx = 0; idx < nrTasks; idx++)
+        {
+            task(idx, 0);
+        }
+        return;
+    }
+
+    // Publish the loop to the workers, only sleeping workers need to be notified
+    std::lock_guard<std::mutex> loopLock(loopMutex);
+    this->task = &task;
+    this->nrTasks = nrTasks;
+    nextTask = 0;
+    nrBusyWorkers = (int)workers.size();
+    taskException = nullptr;
+    bool wakeWorkers;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        generation++;
+        wakeWorkers = (nrSleepingWorkers > 0);
+    }
+    if (wakeWorkers)
+    {
+        taskCondition.notify_all();
+    }
+
+    // Take part in the work and wait for the workers to finish
+    RunTasks(0);
+    if (!SpinWait([this]() { return nrBusyWorkers == 0; }))
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        isCallerWaiting = true;
+        doneCondition.wait(lock, [this]() { return nrBusyWorkers == 0; });
+        isCallerWaiting = false;
+    }
+    this->task = nullptr;
+    if (taskException)
+    {
+        std::rethrow_exception(taskException);
+    }
+}
+
+void ThreadPool::WorkerLoop(int threadIdx)
+{
+    unsigned int lastGeneration = 0;
+    while (true)
+    {
+        // Wait for a new loop (or the destruction of the pool)
+        auto hasWork = [&]() { return stopping || (generation != lastGeneration); };
+        if (!SpinWait(hasWork))
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            nrSleepingWorkers++;
+            taskCondition.wait(lock, hasWork);
+            nrSleepingWorkers--;
+        }
+        if (stopping)
+        {
+            return;
+        }
+        lastGeneration = generation;
+        RunTasks(threadIdx);
+        // Notify the calling thread when the last worker is done (if it sleeps)
+        if (--nrBusyWorkers == 0)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (isCallerWaiting)
+            {
+                doneCondition.notify_one();
+            }
+        }
+    }
+}
+
+void ThreadPool::RunTasks(int threadIdx)
+{
+    int idx;
+    while ((idx = nextTask.fetch_add(1)) < nrTasks)
+    {
+        try
+        {
+            (*task)(idx, threadIdx);
+        }
+        catch (...)
+        {
+            // Keep the first exception and skip the remaining iterations
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!taskException)
+            {
+                taskException = std::current_exception();
+            }
+            nextTask = nrTasks;
+        }
+    }
+}
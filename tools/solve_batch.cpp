@@ -0,0 +1,294 @@
+//----------------------------------------------------------------------------------//
+// MIT License
+//
+// Copyright (c) [2020-] [Mostafa Emam]
+//
+// Author(s): Mostafa Emam (mostafa.emam92@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//----------------------------------------------------------------------------------//
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <future>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include "HungarianAlgorithm.h"
+#include "BatchFile.h"
+
+//----------------------------------------------------------------------------------//
+// Solves all problems of a batch file (see BatchFile.h) and streams the results to an
+// output file. The input is memory-mapped and solved in chunks of consecutive
+// problems: the problems of a chunk are solved in parallel, one HungarianAlgorithm<T>
+// per thread using the mapped costs without copying them, while the results of the
+// previous chunk are written by a separate thread. The pages of written chunks are
+// released, so the memory use does not grow with the size of the input. Problems whose
+// costs exceed the memory limit of a thread (--max-memory in MB divided by the number
+// of threads) are solved out of core: their rows are read in blocks into a cache of
+// this size, and their mapped pages are released after reading.
+//
+// Binary output (native byte order): char[8] "HUNGRSLT", uint32 version (1), uint32 0,
+// uint64 number of problems, then for each problem uint32 nrRows, uint32 nrCols,
+// double total cost, int32 row indices[nrRows], int32 col indices[nrCols] (-1 for
+// unassigned rows/cols). The text output has one line per problem:
+// "<total cost> <row indices> | <col indices>".
+//
+// Usage:
+//      HungAlgoSolveBatch <input file> <output file> [--strategy ShortestAugmentingPath]
+//                         [--threads 0] [--chunk-size 1024] [--format binary|text]
+//                         [--max-memory 0 (unlimited)]
+//----------------------------------------------------------------------------------//
+
+// Settings of the solve
+struct SolveSettings
+{
+    std::string inputFile, outputFile;
+    SolverStrategy strategy = SolverStrategy::ShortestAugmentingPath;
+    int nrThreads = 0;
+    int chunkSize = 1024;
+    bool textOutput = false;
+    // Memory limit of the mapped costs in bytes (0 -> unlimited)
+    size_t maxMemoryBytes = 0;
+};
+
+// Results of a chunk of consecutive problems
+struct ChunkResults
+{
+    int firstIdx = 0, nrProblems = 0;
+    // Offset of the results of each problem (row indices followed by col indices)
+    std::vector<size_t> offsets;
+    std::vector<int> indices;
+    std::vector<double> totalCosts;
+};
+
+template <typename T>
+void solveBatchFile(BatchFileReader &reader, const SolveSettings &settings, std::ostream &output);
+void writeChunk(const BatchFileReader &reader, const ChunkResults &chunk, bool textOutput, std::ostream &output);
+
+int main(int argc, const char *argv[])
+{
+    SolveSettings settings;
+    if (argc < 3)
+    {
+        std::cerr << "Usage: HungAlgoSolveBatch <input file> <output file> [--strategy ShortestAugmentingPath] "
+                     "[--threads 0] [--chunk-size 1024] [--format binary|text] [--max-memory 0]\n";
+        return 1;
+    }
+    settings.inputFile = argv[1];
+    settings.outputFile = argv[2];
+    for (int idxArg = 3; idxArg + 1 < argc; idxArg += 2)
+    {
+        std::string option = argv[idxArg], value = argv[idxArg + 1];
+        if (option == "--strategy")
+        {
+            int strategy = 0;
+            while ((strategy <= SolverStrategy::Auction) && (value != SolverStrategyName[strategy]))
+            {
+                strategy++;
+            }
+            if (strategy > SolverStrategy::Auction)
+            {
+                std::cerr << "Unknown strategy " << value << "\n";
+                return 1;
+            }
+            settings.strategy = (SolverStrategy)strategy;
+        }
+        else if (option == "--threads")
+        {
+            settings.nrThreads = std::atoi(value.c_str());
+        }
+        else if (option == "--chunk-size")
+        {
+            settings.chunkSize = std::max(1, std::atoi(value.c_str()));
+        }
+        else if (option == "--format")
+        {
+            settings.textOutput = (value == "text");
+        }
+        else if (option == "--max-memory")
+        {
+            settings.maxMemoryBytes = (size_t)std::max(0LL, std::atoll(value.c_str())) << 20;
+        }
+        else
+        {
+            std::cerr << "Unknown option " << option << "\n";
+            return 1;
+        }
+    }
+
+    try
+    {
+        BatchFileReader reader(settings.inputFile);
+        std::ofstream output(settings.outputFile, std::ios::binary | std::ios::trunc);
+        if (!output)
+        {
+            std::cerr << "The output file cannot be created!\n";
+            return 1;
+        }
+        switch (reader.GetValueType())
+        {
+        case BatchValueType::BatchInt32:
+            solveBatchFile<int>(reader, settings, output);
+            break;
+        case BatchValueType::BatchFloat32:
+            solveBatchFile<float>(reader, settings, output);
+            break;
+        case BatchValueType::BatchFloat64:
+            solveBatchFile<double>(reader, settings, output);
+            break;
+        case BatchValueType::BatchInt16:
+            solveBatchFile<int16_t>(reader, settings, output);
+            break;
+        case BatchValueType::BatchUInt16:
+            solveBatchFile<uint16_t>(reader, settings, output);
+            break;
+        case BatchValueType::BatchInt64:
+            solveBatchFile<int64_t>(reader, settings, output);
+            break;
+        }
+        output.close();
+        if (output.fail())
+        {
+            std::cerr << "The output file cannot be written!\n";
+            return 1;
+        }
+    }
+    catch (const std::exception &exception)
+    {
+        std::cerr << "ERROR: " << exception.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
+
+template <typename T>
+void solveBatchFile(BatchFileReader &reader, const SolveSettings &settings, std::ostream &output)
+{
+    ThreadPool threadPool(settings.nrThreads);
+    // One solver with reusable buffers per thread
+    std::vector<HungarianAlgorithm<T>> solvers(threadPool.GetNrThreads());
+    std::vector<std::vector<int>> rowIndices(threadPool.GetNrThreads()), colIndices(threadPool.GetNrThreads());
+    for (HungarianAlgorithm<T> &solver : solvers)
+    {
+        solver.SetSolverStrategy(settings.strategy);
+    }
+
+    if (!settings.textOutput)
+    {
+        unsigned char header[24] = {'H', 'U', 'N', 'G', 'R', 'S', 'L', 'T'};
+        uint32_t version = 1;
+        uint64_t nrProblems = reader.GetNrOfProblems();
+        std::memcpy(header + 8, &version, sizeof(uint32_t));
+        std::memcpy(header + 16, &nrProblems, sizeof(uint64_t));
+        output.write(reinterpret_cast<const char *>(header), sizeof(header));
+    }
+    reader.AdviseSequential();
+    // Problems larger than the memory limit of a thread are solved out of core
+    size_t maxProblemBytes = (settings.maxMemoryBytes > 0) ? settings.maxMemoryBytes / threadPool.GetNrThreads() : std::numeric_limits<size_t>::max();
+
+    // Two chunks: one is solved while the other one is written
+    ChunkResults chunks[2];
+    std::future<void> writing;
+    for (int firstIdx = 0, idxChunk = 0; firstIdx < reader.GetNrOfProblems(); firstIdx += settings.chunkSize, idxChunk++)
+    {
+        ChunkResults &chunk = chunks[idxChunk % 2];
+        chunk.firstIdx = firstIdx;
+        chunk.nrProblems = std::min(settings.chunkSize, reader.GetNrOfProblems() - firstIdx);
+        chunk.offsets.resize(chunk.nrProblems + 1);
+        chunk.offsets[0] = 0;
+        for (int idx = 0; idx < chunk.nrProblems; idx++)
+        {
+            chunk.offsets[idx + 1] = chunk.offsets[idx] + reader.GetNrRows(firstIdx + idx) + reader.GetNrCols(firstIdx + idx);
+        }
+        chunk.indices.resize(chunk.offsets[chunk.nrProblems]);
+        chunk.totalCosts.resize(chunk.nrProblems);
+
+        threadPool.ParallelFor(chunk.nrProblems, [&](int idx, int threadIdx) {
+            int problemIdx = chunk.firstIdx + idx;
+            int nrRows = reader.GetNrRows(problemIdx), nrCols = reader.GetNrCols(problemIdx);
+            HungarianAlgorithm<T> &solver = solvers[threadIdx];
+            if ((size_t)nrRows * nrCols * sizeof(T) > maxProblemBytes)
+            {
+                // Rows read in blocks into a cache within the memory limit
+                if (nrRows > nrCols)
+                {
+                    throw std::invalid_argument("Problems above the memory limit must not have more rows than cols!");
+                }
+                solver.SetCostFunction(nrRows, nrCols, nullptr, reader.GetRowBlockFunction<T>(problemIdx), maxProblemBytes);
+            }
+            else
+            {
+                // Row-major costs used in place
+                solver.SetCostFunctionView(reader.GetCosts<T>(problemIdx), nrRows, nrCols, nrCols, 1);
+            }
+            solver.SolveAssignmentProblem();
+            solver.GetAssignmentResults(rowIndices[threadIdx], colIndices[threadIdx]);
+            std::copy(rowIndices[threadIdx].begin(), rowIndices[threadIdx].end(), chunk.indices.begin() + chunk.offsets[idx]);
+            std::copy(colIndices[threadIdx].begin(), colIndices[threadIdx].end(), chunk.indices.begin() + chunk.offsets[idx] + nrRows);
+            chunk.totalCosts[idx] = solver.GetTotalCost();
+        });
+
+        // Wait for the previous chunk to be written, then write this one while the next one is solved
+        if (writing.valid())
+        {
+            writing.get();
+        }
+        writing = std::async(std::launch::async, [&reader, &chunk, &settings, &output]() {
+            writeChunk(reader, chunk, settings.textOutput, output);
+            reader.ReleaseProblems(chunk.firstIdx, chunk.firstIdx + chunk.nrProblems);
+        });
+    }
+    if (writing.valid())
+    {
+        writing.get();
+    }
+}
+
+void writeChunk(const BatchFileReader &reader, const ChunkResults &chunk, bool textOutput, std::ostream &output)
+{
+    for (int idx = 0; idx < chunk.nrProblems; idx++)
+    {
+        uint32_t nrRows = reader.GetNrRows(chunk.firstIdx + idx), nrCols = reader.GetNrCols(chunk.firstIdx + idx);
+        const int *indices = chunk.indices.data() + chunk.offsets[idx];
+        if (textOutput)
+        {
+            output << std::setprecision(std::numeric_limits<double>::max_digits10) << chunk.totalCosts[idx];
+            for (uint32_t row = 0; row < nrRows; row++)
+            {
+                output << " " << indices[row];
+            }
+            output << " |";
+            for (uint32_t col = 0; col < nrCols; col++)
+            {
+                output << " " << indices[nrRows + col];
+            }
+            output << "\n";
+        }
+        else
+        {
+            output.write(reinterpret_cast<const char *>(&nrRows), sizeof(uint32_t));
+            output.write(reinterpret_cast<const char *>(&nrCols), sizeof(uint32_t));
+            output.write(reinterpret_cast<const char *>(&chunk.totalCosts[idx]), sizeof(double));
+            output.write(reinterpret_cast<const char *>(indices), (nrRows + nrCols) * sizeof(int32_t));
+        }
+    }
+}